@@ -20,6 +20,84 @@
 		output [31:0] desired_pos,      // 목표 위치
 		input [31:0] actual_pos,        // 실제 위치
 
+		// 상태 스냅샷 페이지 (0x20 ~ 0x3C), SNAP_TS_LO 읽기 시 페이지 전체 고정
+		input [63:0] snap_ts,           // 틱 타임스탬프 (10 ns)
+		input [31:0] snap_tick,         // 틱 카운터
+		input [31:0] snap_desired,      // 목표 위치
+		input [31:0] snap_actual,       // 실제 위치
+		input [31:0] snap_error,        // 위치 오차
+		input [31:0] snap_control,      // 제어 신호
+		input [31:0] snap_flags,        // 상태 플래그
+
+		// biquad 캐스케이드 (0x10 ~ 0x1C)
+		output reg bq_coef_we,          // BQ_DATA 쓰기 펄스
+		output reg [8:0] bq_coef_sel,   // 쓰기 시점의 BQ_SEL
+		output reg [31:0] bq_coef_wdata,
+		output [8:0] bq_coef_rsel,      // 현재 BQ_SEL (BQ_DATA 읽기 위치)
+		input [31:0] bq_coef_rdata,     // bq_coef_rsel 위치의 shadow 계수
+		output reg bq_commit,           // BQ_CTRL[31] 쓰기 펄스
+		output bq_commit_clear,
+		output [15:0] bq_enable_mask,
+		output reg [1:0] bq_sat_clear,  // BQ_STAT W1C 펄스
+		input [31:0] bq_status,         // [31] commit 대기, [17:2] 활성 마스크, [1:0] 포화
+
+		// 외란 관측기 (0x40 ~ 0x50)
+		output dob_enable,              // DOB_CTRL[0]
+		output reg dob_clear,           // DOB_CTRL[1] 쓰기 펄스
+		output [2:0] dob_vel_shift,     // DOB_CTRL[6:4]
+		output [15:0] dob_alpha,        // DOB_CTRL[31:16]
+		output [31:0] dob_k_j,
+		output [31:0] dob_b_n,
+		output [15:0] dob_limit,
+		input [31:0] dob_est,           // 추정 외란 (RO)
+
+		// 안전 감시기 (0x54 ~ 0x6C)
+		output [4:0] safe_mask,         // SAFE_CTRL[4:0]
+		output safe_brake,              // SAFE_CTRL[8]
+		output reg safe_clear,          // SAFE_CTRL[31] 쓰기 펄스
+		output reg safe_force_trip,     // SAFE_CTRL[30] 쓰기 펄스
+		output [31:0] safe_follow,
+		output [15:0] safe_speed,       // SAFE_LIMITS[15:0]
+		output [15:0] safe_sat_ticks,   // SAFE_LIMITS[31:16]
+		output [30:0] safe_wd_timeout,
+		output reg safe_wd_kick,        // SAFE_WD 쓰기 펄스
+		input [31:0] safe_status,       // [31] 트립, [13:8] 현재 원인, [5:0] 래치된 원인
+		input [63:0] safe_trip_ts,      // 트립 시각 (10 ns)
+
+		// 엔코더 프런트엔드 (0x70 ~ 0x8C)
+		output [7:0] enc_filter_depth,  // ENC_CTRL[7:0]
+		output [1:0] enc_decode_mode,   // ENC_CTRL[9:8]
+		output reg enc_status_clear,    // ENC_CTRL[31] 쓰기 펄스
+		output [15:0] enc_index_cpr,    // ENC_INDEX[15:0]
+		output [7:0] enc_index_tol,     // ENC_INDEX[23:16]
+		input [31:0] enc_status,        // [2] Index 래치, [1] Index 간격 오류, [0] 무효 전이
+		input [31:0] enc_invalid_count,
+		input [63:0] enc_position64,
+		input [63:0] enc_index_position,
+
+		// 2자유도 PID (0x90 ~ 0xA8)
+		output pid2_select,             // PID2_CTRL[0]
+		output reg pid2_clear,          // PID2_CTRL[1] 쓰기 펄스
+		output [15:0] pid2_d_alpha,     // PID2_CTRL[31:16]
+		output [28:0] pid2_kp,          // [23:0] 가수, [28:24] 시프트
+		output [28:0] pid2_ki,
+		output [28:0] pid2_kd,
+		output [28:0] pid2_kt,
+		output [15:0] pid2_weight_p,    // PID2_WEIGHT[15:0]
+		output [15:0] pid2_weight_d,    // PID2_WEIGHT[31:16]
+		input [31:0] pid2_integ,        // I 상태 (RO)
+
+		// 윤곽 제어 (0xAC ~ 0xC0). 축 0 인스턴스의 설정이 contour_coupler 로 연결된다
+		output cc_enable,               // CC_CTRL[0]
+		output reg cc_clear,            // CC_CTRL[1] 쓰기 펄스
+		output [2:0] cc_vel_shift,      // CC_CTRL[6:4]
+		output [28:0] cc_gain,          // [23:0] 가수, [28:24] 시프트
+		output [15:0] cc_limit,         // CC_LIMIT[15:0]
+		output [15:0] cc_min_speed,     // CC_LIMIT[31:16]
+		input [31:0] cc_err,            // 윤곽 오차 (RO, Q24.8)
+		input [31:0] cc_peak,           // 최대 |윤곽 오차| (RO)
+		input [31:0] cc_status,         // [16] 방향 확보, [15:0] 이 축 보정 (RO)
+
 		// User ports ends
 		// Do not modify the ports beyond this line
 
@@ -103,16 +181,49 @@
 	// ADDR_LSB = 2 for 32 bits (n downto 2)
 	// ADDR_LSB = 3 for 64 bits (n downto 3)
 	localparam integer ADDR_LSB = (C_S_AXI_DATA_WIDTH/32) + 1;
-	localparam integer OPT_MEM_ADDR_BITS = 1;
+	localparam integer OPT_MEM_ADDR_BITS = 5;
 	//----------------------------------------------
 	//-- Signals for user logic register space example
 	//------------------------------------------------
-	//-- Number of Slave Registers 4
+	//-- Number of Slave Registers 4 (+ 0x10 ~ 0x1C biquad, 0x20 ~ 0x3C read-only snapshot page, 0x40 ~ 0x50 DOB, 0x54 ~ 0x6C safety, 0x70 ~ 0x8C encoder)
 	reg [C_S_AXI_DATA_WIDTH-1:0]	slv_reg0;
 	reg [C_S_AXI_DATA_WIDTH-1:0]	slv_reg1;
 	reg [C_S_AXI_DATA_WIDTH-1:0]	slv_reg2;
 	reg [C_S_AXI_DATA_WIDTH-1:0]	slv_reg3;
+	reg [8:0]	bq_sel_reg;             // BQ_SEL: [3:0] 계수, [7:4] 단, [8] 체인
+	localparam [3:0] BQ_LAST_STAGE = 4'd3; // biquad_cascade NUM_STAGES - 1
+	reg [30:0]	bq_ctrl_reg;            // BQ_CTRL: [15:0] 단 enable, [30] commit 시 상태 초기화
+	reg [31:0]	dob_ctrl_reg;           // DOB_CTRL: [0] enable, [6:4] 속도 창, [31:16] alpha ([1] 은 저장 안 함)
+	reg [31:0]	dob_k_j_reg;            // DOB_KJ: alpha * J (Q16.16)
+	reg [31:0]	dob_b_n_reg;            // DOB_B: B (Q16.16)
+	reg [15:0]	dob_limit_reg;          // DOB_LIMIT: |보상| 제한
+	reg [8:0]	safe_ctrl_reg;          // SAFE_CTRL: [4:0] 원인 enable, [8] 제동
+	reg [31:0]	safe_follow_reg;        // SAFE_FOLLOW: 추종 오차 한계
+	reg [31:0]	safe_limits_reg;        // SAFE_LIMITS: [15:0] 과속 (카운트/틱), [31:16] 연속 포화 틱
+	reg [30:0]	safe_wd_reg;            // SAFE_WD: 워치독 timeout (10 ns)
+	reg		safe_wd_wr;             // SAFE_WD 쓰기 → 다음 클럭 kick (새 timeout 으로 재장전)
+	reg [9:0]	enc_ctrl_reg;           // ENC_CTRL: [7:0] 필터 깊이, [9:8] 디코드 모드
+	reg [23:0]	enc_index_reg;          // ENC_INDEX: [15:0] Index 간 카운트, [23:16] 허용 오차
+	reg [31:0]	enc_pos_hi_shadow;      // ENC_POS_LO 읽기 시점의 상위 워드
+	reg [31:0]	enc_idx_hi_shadow;      // ENC_IDX_LO 읽기 시점의 상위 워드
+	reg [31:0]	pid2_ctrl_reg;          // PID2_CTRL: [0] 선택, [31:16] D 필터 alpha ([1] 은 저장 안 함)
+	reg [28:0]	pid2_kp_reg;
+	reg [28:0]	pid2_ki_reg;
+	reg [28:0]	pid2_kd_reg;
+	reg [28:0]	pid2_kt_reg;
+	reg [31:0]	pid2_weight_reg;        // PID2_WEIGHT: [15:0] P 가중치, [31:16] D 가중치 (Q1.15)
+	reg [6:0]	cc_ctrl_reg;            // CC_CTRL: [0] enable, [6:4] 속도 필터 ([1] 은 저장 안 함)
+	reg [28:0]	cc_gain_reg;
+	reg [31:0]	cc_limit_reg;           // CC_LIMIT: [15:0] 보정 제한, [31:16] 최소 속도 (Q8.8)
 	wire	 slv_reg_rden;
+	// 스냅샷 shadow (SNAP_TS_LO 읽기 시점의 페이지)
+	reg [31:0]	snap_shadow_ts_hi;
+	reg [31:0]	snap_shadow_tick;
+	reg [31:0]	snap_shadow_desired;
+	reg [31:0]	snap_shadow_actual;
+	reg [31:0]	snap_shadow_error;
+	reg [31:0]	snap_shadow_control;
+	reg [31:0]	snap_shadow_flags;
 	wire	 slv_reg_wren;
 	reg [C_S_AXI_DATA_WIDTH-1:0]	 reg_data_out;
 	integer	 byte_index;
@@ -233,28 +344,28 @@
 	    if (slv_reg_wren)
 	      begin
 	        case ( axi_awaddr[ADDR_LSB+OPT_MEM_ADDR_BITS:ADDR_LSB] )
-	          2'h0:
+	          6'h00:
 	            for ( byte_index = 0; byte_index <= (C_S_AXI_DATA_WIDTH/8)-1; byte_index = byte_index+1 )
 	              if ( S_AXI_WSTRB[byte_index] == 1 ) begin
 	                // Respective byte enables are asserted as per write strobes 
 	                // Slave register 0
 	                slv_reg0[(byte_index*8) +: 8] <= S_AXI_WDATA[(byte_index*8) +: 8];
 	              end  
-	          2'h1:
+	          6'h01:
 	            for ( byte_index = 0; byte_index <= (C_S_AXI_DATA_WIDTH/8)-1; byte_index = byte_index+1 )
 	              if ( S_AXI_WSTRB[byte_index] == 1 ) begin
 	                // Respective byte enables are asserted as per write strobes 
 	                // Slave register 1
 	                slv_reg1[(byte_index*8) +: 8] <= S_AXI_WDATA[(byte_index*8) +: 8];
 	              end  
-//	          2'h2:
+//	          6'h02:
 //	            for ( byte_index = 0; byte_index <= (C_S_AXI_DATA_WIDTH/8)-1; byte_index = byte_index+1 )
 //	              if ( S_AXI_WSTRB[byte_index] == 1 ) begin
 //	                // Respective byte enables are asserted as per write strobes 
 //	                // Slave register 2
 //	                slv_reg2[(byte_index*8) +: 8] <= S_AXI_WDATA[(byte_index*8) +: 8];
 //	              end  
-	          2'h3:
+	          6'h03:
 	            for ( byte_index = 0; byte_index <= (C_S_AXI_DATA_WIDTH/8)-1; byte_index = byte_index+1 )
 	              if ( S_AXI_WSTRB[byte_index] == 1 ) begin
 	                // Respective byte enables are asserted as per write strobes 
@@ -374,10 +485,55 @@
 	begin
 	      // Address decoding for reading registers
 	      case ( axi_araddr[ADDR_LSB+OPT_MEM_ADDR_BITS:ADDR_LSB] )
-	        2'h0   : reg_data_out <= slv_reg0;
-	        2'h1   : reg_data_out <= slv_reg1;
-	        2'h2   : reg_data_out <= slv_reg2;
-	        2'h3   : reg_data_out <= slv_reg3;
+	        6'h00   : reg_data_out <= slv_reg0;
+	        6'h01   : reg_data_out <= slv_reg1;
+	        6'h02   : reg_data_out <= slv_reg2;
+	        6'h03   : reg_data_out <= slv_reg3;
+	        6'h04   : reg_data_out <= {23'd0, bq_sel_reg};
+	        6'h05   : reg_data_out <= bq_coef_rdata;
+	        6'h06   : reg_data_out <= {bq_status[31], bq_ctrl_reg};
+	        6'h07   : reg_data_out <= bq_status;
+	        6'h08   : reg_data_out <= snap_ts[31:0];     // 읽는 순간 shadow 로 고정
+	        6'h09   : reg_data_out <= snap_shadow_ts_hi;
+	        6'h0A   : reg_data_out <= snap_shadow_tick;
+	        6'h0B   : reg_data_out <= snap_shadow_desired;
+	        6'h0C   : reg_data_out <= snap_shadow_actual;
+	        6'h0D   : reg_data_out <= snap_shadow_error;
+	        6'h0E   : reg_data_out <= snap_shadow_control;
+	        6'h0F   : reg_data_out <= snap_shadow_flags;
+	        6'h10   : reg_data_out <= dob_ctrl_reg;
+	        6'h11   : reg_data_out <= dob_k_j_reg;
+	        6'h12   : reg_data_out <= dob_b_n_reg;
+	        6'h13   : reg_data_out <= {16'd0, dob_limit_reg};
+	        6'h14   : reg_data_out <= dob_est;
+	        6'h15   : reg_data_out <= {23'd0, safe_ctrl_reg};
+	        6'h16   : reg_data_out <= safe_follow_reg;
+	        6'h17   : reg_data_out <= safe_limits_reg;
+	        6'h18   : reg_data_out <= {1'b0, safe_wd_reg};
+	        6'h19   : reg_data_out <= safe_status;
+	        6'h1A   : reg_data_out <= safe_trip_ts[31:0];
+	        6'h1B   : reg_data_out <= safe_trip_ts[63:32];
+	        6'h1C   : reg_data_out <= {22'd0, enc_ctrl_reg};
+	        6'h1D   : reg_data_out <= {8'd0, enc_index_reg};
+	        6'h1E   : reg_data_out <= enc_status;
+	        6'h1F   : reg_data_out <= enc_invalid_count;
+	        6'h20   : reg_data_out <= enc_position64[31:0];     // 읽는 순간 상위 워드 고정
+	        6'h21   : reg_data_out <= enc_pos_hi_shadow;
+	        6'h22   : reg_data_out <= enc_index_position[31:0];
+	        6'h23   : reg_data_out <= enc_idx_hi_shadow;
+	        6'h24   : reg_data_out <= pid2_ctrl_reg;
+	        6'h25   : reg_data_out <= {3'd0, pid2_kp_reg};
+	        6'h26   : reg_data_out <= {3'd0, pid2_ki_reg};
+	        6'h27   : reg_data_out <= {3'd0, pid2_kd_reg};
+	        6'h28   : reg_data_out <= {3'd0, pid2_kt_reg};
+	        6'h29   : reg_data_out <= pid2_weight_reg;
+	        6'h2A   : reg_data_out <= pid2_integ;
+	        6'h2B   : reg_data_out <= {25'd0, cc_ctrl_reg};
+	        6'h2C   : reg_data_out <= {3'd0, cc_gain_reg};
+	        6'h2D   : reg_data_out <= cc_limit_reg;
+	        6'h2E   : reg_data_out <= cc_err;
+	        6'h2F   : reg_data_out <= cc_peak;
+	        6'h30   : reg_data_out <= cc_status;
 	        default : reg_data_out <= 0;
 	      endcase
 	end
@@ -412,6 +568,262 @@
 			slv_reg2 <= actual_pos; // Synchronize actual position
 	end
 
+	// SNAP_TS_LO(0x20) 읽기 시 나머지 스냅샷 워드를 같은 틱 값으로 고정
+	// → 이후 0x24 ~ 0x3C 를 읽는 동안 새 틱이 와도 한 샘플로 일관됨
+	always @(posedge S_AXI_ACLK)
+	begin
+		if (S_AXI_ARESETN == 1'b0) begin
+			snap_shadow_ts_hi <= 32'b0;
+			snap_shadow_tick <= 32'b0;
+			snap_shadow_desired <= 32'b0;
+			snap_shadow_actual <= 32'b0;
+			snap_shadow_error <= 32'b0;
+			snap_shadow_control <= 32'b0;
+			snap_shadow_flags <= 32'b0;
+		end else if (slv_reg_rden && axi_araddr[ADDR_LSB+OPT_MEM_ADDR_BITS:ADDR_LSB] == 6'h08) begin
+			snap_shadow_ts_hi <= snap_ts[63:32];
+			snap_shadow_tick <= snap_tick;
+			snap_shadow_desired <= snap_desired;
+			snap_shadow_actual <= snap_actual;
+			snap_shadow_error <= snap_error;
+			snap_shadow_control <= snap_control;
+			snap_shadow_flags <= snap_flags;
+		end
+	end
+
+	// biquad 계수 로드: BQ_SEL 설정 후 BQ_DATA 연속 쓰기 (계수 인덱스 자동 증가, a2 다음은 다음 단 b0, 마지막 단 a2 다음은 다음 체인 0단 b0)
+	// BQ_CTRL 에 bit31 을 함께 쓰면 commit 펄스 → 다음 틱 전에 계수/enable 일괄 적용
+	always @(posedge S_AXI_ACLK)
+	begin
+		if (S_AXI_ARESETN == 1'b0) begin
+			bq_sel_reg <= 9'd0;
+			bq_ctrl_reg <= 31'd0;
+			bq_coef_we <= 1'b0;
+			bq_coef_sel <= 9'd0;
+			bq_coef_wdata <= 32'd0;
+			bq_commit <= 1'b0;
+			bq_sat_clear <= 2'b00;
+		end else begin
+			bq_coef_we <= 1'b0;
+			bq_commit <= 1'b0;
+			bq_sat_clear <= 2'b00;
+			if (slv_reg_wren) begin
+				case ( axi_awaddr[ADDR_LSB+OPT_MEM_ADDR_BITS:ADDR_LSB] )
+					6'h04: bq_sel_reg <= S_AXI_WDATA[8:0];
+					6'h05: begin
+						bq_coef_we <= 1'b1;
+						bq_coef_sel <= bq_sel_reg;
+						bq_coef_wdata <= S_AXI_WDATA;
+						if (bq_sel_reg[3:0] >= 4'd4 && bq_sel_reg[7:4] >= BQ_LAST_STAGE)
+							bq_sel_reg <= {~bq_sel_reg[8], 8'd0};
+						else if (bq_sel_reg[3:0] >= 4'd4)
+							bq_sel_reg <= {bq_sel_reg[8:4] + 5'd1, 4'd0};
+						else
+							bq_sel_reg <= bq_sel_reg + 9'd1;
+					end
+					6'h06: begin
+						bq_ctrl_reg <= S_AXI_WDATA[30:0];
+						bq_commit <= S_AXI_WDATA[31];
+					end
+					6'h07: bq_sat_clear <= S_AXI_WDATA[1:0];
+					default: ;
+				endcase
+			end
+		end
+	end
+
+	assign bq_coef_rsel = bq_sel_reg;
+	assign bq_commit_clear = bq_ctrl_reg[30];
+	assign bq_enable_mask = bq_ctrl_reg[15:0];
+
+	// 외란 관측기 설정: DOB_CTRL bit1 은 상태 초기화 펄스 (enable 과 함께 써도 됨)
+	always @(posedge S_AXI_ACLK)
+	begin
+		if (S_AXI_ARESETN == 1'b0) begin
+			dob_ctrl_reg <= 32'd0;
+			dob_k_j_reg <= 32'd0;
+			dob_b_n_reg <= 32'd0;
+			dob_limit_reg <= 16'd0;
+			dob_clear <= 1'b0;
+		end else begin
+			dob_clear <= 1'b0;
+			if (slv_reg_wren) begin
+				case ( axi_awaddr[ADDR_LSB+OPT_MEM_ADDR_BITS:ADDR_LSB] )
+					6'h10: begin
+						dob_ctrl_reg <= {S_AXI_WDATA[31:2], 1'b0, S_AXI_WDATA[0]};
+						dob_clear <= S_AXI_WDATA[1];
+					end
+					6'h11: dob_k_j_reg <= S_AXI_WDATA;
+					6'h12: dob_b_n_reg <= S_AXI_WDATA;
+					6'h13: dob_limit_reg <= S_AXI_WDATA[15:0];
+					default: ;
+				endcase
+			end
+		end
+	end
+
+	assign dob_enable = dob_ctrl_reg[0];
+	assign dob_vel_shift = dob_ctrl_reg[6:4];
+	assign dob_alpha = dob_ctrl_reg[31:16];
+	assign dob_k_j = dob_k_j_reg;
+	assign dob_b_n = dob_b_n_reg;
+	assign dob_limit = dob_limit_reg;
+
+	// 안전 감시기 설정: SAFE_CTRL bit31 = 트립 해제, bit30 = 소프트웨어 트립 (펄스)
+	// SAFE_WD 쓰기는 항상 워치독 재장전, bit31 을 함께 쓰면 timeout 은 유지 (kick 전용)
+	always @(posedge S_AXI_ACLK)
+	begin
+		if (S_AXI_ARESETN == 1'b0) begin
+			safe_ctrl_reg <= 9'd0;
+			safe_follow_reg <= 32'd0;
+			safe_limits_reg <= 32'd0;
+			safe_wd_reg <= 31'd0;
+			safe_clear <= 1'b0;
+			safe_force_trip <= 1'b0;
+			safe_wd_kick <= 1'b0;
+			safe_wd_wr <= 1'b0;
+		end else begin
+			safe_clear <= 1'b0;
+			safe_force_trip <= 1'b0;
+			safe_wd_wr <= 1'b0;
+			safe_wd_kick <= safe_wd_wr;
+			if (slv_reg_wren) begin
+				case ( axi_awaddr[ADDR_LSB+OPT_MEM_ADDR_BITS:ADDR_LSB] )
+					6'h15: begin
+						safe_ctrl_reg <= S_AXI_WDATA[8:0];
+						safe_force_trip <= S_AXI_WDATA[30];
+						safe_clear <= S_AXI_WDATA[31];
+					end
+					6'h16: safe_follow_reg <= S_AXI_WDATA;
+					6'h17: safe_limits_reg <= S_AXI_WDATA;
+					6'h18: begin
+						if (!S_AXI_WDATA[31])
+							safe_wd_reg <= S_AXI_WDATA[30:0];
+						safe_wd_wr <= 1'b1;
+					end
+					default: ;
+				endcase
+			end
+		end
+	end
+
+	assign safe_mask = safe_ctrl_reg[4:0];
+	assign safe_brake = safe_ctrl_reg[8];
+	assign safe_follow = safe_follow_reg;
+	assign safe_speed = safe_limits_reg[15:0];
+	assign safe_sat_ticks = safe_limits_reg[31:16];
+	assign safe_wd_timeout = safe_wd_reg;
+
+	// 엔코더 설정 (리셋 시 필터 깊이 4, x4). ENC_CTRL bit31 = 상태 클리어 펄스
+	// 64비트 위치 / Index 위치는 LO 를 읽는 순간 HI 를 shadow 로 고정 → LO, HI 순서로 읽으면 원자적
+	always @(posedge S_AXI_ACLK)
+	begin
+		if (S_AXI_ARESETN == 1'b0) begin
+			enc_ctrl_reg <= 10'd4;
+			enc_index_reg <= 24'd0;
+			enc_status_clear <= 1'b0;
+		end else begin
+			enc_status_clear <= 1'b0;
+			if (slv_reg_wren) begin
+				case ( axi_awaddr[ADDR_LSB+OPT_MEM_ADDR_BITS:ADDR_LSB] )
+					6'h1C: begin
+						enc_ctrl_reg <= S_AXI_WDATA[9:0];
+						enc_status_clear <= S_AXI_WDATA[31];
+					end
+					6'h1D: enc_index_reg <= S_AXI_WDATA[23:0];
+					default: ;
+				endcase
+			end
+		end
+	end
+
+	always @(posedge S_AXI_ACLK)
+	begin
+		if (S_AXI_ARESETN == 1'b0) begin
+			enc_pos_hi_shadow <= 32'd0;
+			enc_idx_hi_shadow <= 32'd0;
+		end else if (slv_reg_rden) begin
+			if (axi_araddr[ADDR_LSB+OPT_MEM_ADDR_BITS:ADDR_LSB] == 6'h20)
+				enc_pos_hi_shadow <= enc_position64[63:32];
+			if (axi_araddr[ADDR_LSB+OPT_MEM_ADDR_BITS:ADDR_LSB] == 6'h22)
+				enc_idx_hi_shadow <= enc_index_position[63:32];
+		end
+	end
+
+	assign enc_filter_depth = enc_ctrl_reg[7:0];
+	assign enc_decode_mode = enc_ctrl_reg[9:8];
+	assign enc_index_cpr = enc_index_reg[15:0];
+	assign enc_index_tol = enc_index_reg[23:16];
+
+	// 2자유도 PID 설정 (리셋 시 기존 제어기 선택, 게인 0, P 가중치 1, D 가중치 0). PID2_CTRL bit1 = 상태 초기화 펄스
+	always @(posedge S_AXI_ACLK)
+	begin
+		if (S_AXI_ARESETN == 1'b0) begin
+			pid2_ctrl_reg <= 32'd0;
+			pid2_kp_reg <= 29'd0;
+			pid2_ki_reg <= 29'd0;
+			pid2_kd_reg <= 29'd0;
+			pid2_kt_reg <= 29'd0;
+			pid2_weight_reg <= 32'h00008000;
+			pid2_clear <= 1'b0;
+		end else begin
+			pid2_clear <= 1'b0;
+			if (slv_reg_wren) begin
+				case ( axi_awaddr[ADDR_LSB+OPT_MEM_ADDR_BITS:ADDR_LSB] )
+					6'h24: begin
+						pid2_ctrl_reg <= S_AXI_WDATA & 32'hFFFF0001;
+						pid2_clear <= S_AXI_WDATA[1];
+					end
+					6'h25: pid2_kp_reg <= S_AXI_WDATA[28:0];
+					6'h26: pid2_ki_reg <= S_AXI_WDATA[28:0];
+					6'h27: pid2_kd_reg <= S_AXI_WDATA[28:0];
+					6'h28: pid2_kt_reg <= S_AXI_WDATA[28:0];
+					6'h29: pid2_weight_reg <= S_AXI_WDATA;
+					default: ;
+				endcase
+			end
+		end
+	end
+
+	assign pid2_select = pid2_ctrl_reg[0];
+	assign pid2_d_alpha = pid2_ctrl_reg[31:16];
+	assign pid2_kp = pid2_kp_reg;
+	assign pid2_ki = pid2_ki_reg;
+	assign pid2_kd = pid2_kd_reg;
+	assign pid2_kt = pid2_kt_reg;
+	assign pid2_weight_p = pid2_weight_reg[15:0];
+	assign pid2_weight_d = pid2_weight_reg[31:16];
+
+	// 윤곽 제어 설정 (리셋 시 끔, 게인 0, 속도 필터 16틱, 제한 500, 최소 속도 1/16 카운트/틱). CC_CTRL bit1 = 초기화 펄스
+	always @(posedge S_AXI_ACLK)
+	begin
+		if (S_AXI_ARESETN == 1'b0) begin
+			cc_ctrl_reg <= 7'h40;
+			cc_gain_reg <= 29'd0;
+			cc_limit_reg <= {16'h0010, 16'd500};
+			cc_clear <= 1'b0;
+		end else begin
+			cc_clear <= 1'b0;
+			if (slv_reg_wren) begin
+				case ( axi_awaddr[ADDR_LSB+OPT_MEM_ADDR_BITS:ADDR_LSB] )
+					6'h2B: begin
+						cc_ctrl_reg <= {S_AXI_WDATA[6:4], 3'd0, S_AXI_WDATA[0]};
+						cc_clear <= S_AXI_WDATA[1];
+					end
+					6'h2C: cc_gain_reg <= S_AXI_WDATA[28:0];
+					6'h2D: cc_limit_reg <= S_AXI_WDATA;
+					default: ;
+				endcase
+			end
+		end
+	end
+
+	assign cc_enable = cc_ctrl_reg[0];
+	assign cc_vel_shift = cc_ctrl_reg[6:4];
+	assign cc_gain = cc_gain_reg;
+	assign cc_limit = cc_limit_reg[15:0];
+	assign cc_min_speed = cc_limit_reg[31:16];
+
 	// Assign user signals
     assign kp_init = slv_reg0[15:0];
     assign ki_init = slv_reg0[31:16];
@@ -1,124 +1,189 @@
+// 쿼드러쳐 엔코더 프런트엔드
+//
+//   A/B/Index → 2단 동기화 → 글리치 필터 (filter_depth 클럭 연속 안정 시 통과, 0 = bypass)
+//             → 상태 전이 디코드 (x4 / x2 / x1) → 64비트 위치
+//
+// filter_depth = 0 이면 동기화 2클럭 + 카운트 1클럭 = 3클럭 지연 (최소 지연 모드).
+// 필터 깊이는 최소 엣지 간격 (클럭) 의 절반 이하로 둔다. 예) 4096 CPR, 6000 rpm → 엣지 간격 약 61클럭.
+// 필터 깊이 / 디코드 모드는 축이 정지한 상태에서 바꾼다 (바꾸는 순간의 엣지는 한 카운트 어긋날 수 있음).
+//
+// 디코드 모드 (CW 순서 00 → 10 → 11 → 01 → 00, {A,B}):
+//   x4 : 모든 유효 전이
+//   x2 : A 엣지만 (00↔10, 11↔01)
+//   x1 : 00↔10 전이만 (정/역방향 같은 엣지를 써서 왕복 시 위치가 어긋나지 않음)
+// A, B 가 동시에 바뀐 전이는 무효로 카운트하지 않고 invalid_count 를 올린다.
+//
+// 리셋 후 첫 동기화 샘플과 filter_depth 가 바뀐 클럭에는 필터 / 이전 상태를 현재 입력으로 다시 맞추고
+// 카운트 / 무효 전이 검출을 건너뛴다 (정지 상태 A=B=1 에서 00 → 11 을 무효 전이로 보지 않도록).
+//
+// Index 상승 엣지마다 현재 위치를 index_position 에 래치한다 (위치는 고치지 않음).
+// index_cpr 가 0 이 아니면 연속 Index 간 이동량이 index_cpr ± index_tol (또는 같은 Index 재통과, 0 ± tol)
+// 인지 확인해 어긋나면 index_error 를 세운다. error_flag = 무효 전이 | Index 간격 오류 (status_clear 까지 유지).
+
 module quadrature_encoder (
     input wire clk,                            // 시스템 클럭 (e.g. 100 MHz)
     input wire reset_n,                        // Active low reset
     input wire A,                              // 비동기 A 신호
     input wire B,                              // 비동기 B 신호
     input wire Index,                          // 비동기 Index 신호
-    output reg signed [31:0] actual_position  // 실제 위치 카운트
-);     
-
-    // Majority Voting 필터링
-    reg [4:0] A_filter, B_filter, Index_filter;
-    reg A_filtered, B_filtered, Index_filtered;
-    reg [3:0] A_sum, B_sum, Index_sum;
 
+    // 설정 (AXI)
+    input wire [7:0] filter_depth,             // 글리치 필터 깊이 (클럭, 0 = bypass)
+    input wire [1:0] decode_mode,              // 0: x4, 1: x2, 2: x1
+    input wire [15:0] index_cpr,               // Index 간 카운트 (디코드 모드 기준, 0 = 검사 안 함)
+    input wire [7:0] index_tol,                // Index 간격 허용 오차
+    input wire status_clear,                   // 무효 전이 카운트 / 플래그 / index_seen 클리어 펄스
+
+    output wire signed [31:0] actual_position, // 실제 위치 카운트 (64비트 위치 하위)
+    output reg signed [63:0] position64,       // 64비트 위치 (래핑 없음)
+    output reg signed [63:0] index_position,   // 마지막 Index 상승 엣지 위치
+    output reg index_seen,                     // Index 래치 이후 (status_clear 까지 유지)
+    output reg [31:0] invalid_count,           // 무효 전이 수 (포화)
+    output reg invalid_seen,
+    output reg index_error,
+    output wire error_flag                     // safety_supervisor 엔코더 오류
+);
+
+    assign actual_position = position64[31:0];
+    assign error_flag = invalid_seen | index_error;
+
+    // 2단 동기화 ({Index, B, A})
+    reg [2:0] meta, sync;
+    reg [1:0] sync_fill;                       // [1] = sync 에 실제 입력 샘플이 들어옴
     always @(posedge clk or negedge reset_n) begin
         if (!reset_n) begin
-            A_filter <= 5'b0;
-            B_filter <= 5'b0;
-            Index_filter <= 5'b0;
-            A_filtered <= 0;
-            B_filtered <= 0;
-            Index_filtered <= 0;
+            meta <= 3'b000;
+            sync <= 3'b000;
+            sync_fill <= 2'b00;
         end else begin
-            // 4비트 Shift Register를 통한 필터링
-            A_filter <= {A_filter[3:0], A};
-            B_filter <= {B_filter[3:0], B};
-            Index_filter <= {Index_filter[3:0], Index};
-
-            // 합계 계산 (majority voting용)
-            A_sum <= A_filter[0] + A_filter[1] + A_filter[2] + A_filter[3] + A_filter[4];
-            B_sum <= B_filter[0] + B_filter[1] + B_filter[2] + B_filter[3] + B_filter[4];
-            Index_sum <= Index_filter[0] + Index_filter[1] + Index_filter[2] + Index_filter[3] + Index_filter[4];
-
-
-            if (A_sum >= 3'd4) begin     
-                A_filtered <= 1'b1;
-            end else if (A_sum <= 3'd1) begin
-                A_filtered <= 1'b0;
-            end else begin
-                A_filtered <= A_filtered; // 이전 상태 유지
-            end
+            meta <= {Index, B, A};
+            sync <= meta;
+            sync_fill <= {sync_fill[0], 1'b1};
+        end
+    end
 
-            if (B_sum >= 3'd4) begin
-                B_filtered <= 1'b1;
-            end else if (B_sum <= 1) begin
-                B_filtered <= 1'b0;
-            end else begin
-                B_filtered <= B_filtered; // 이전 상태 유지
-            end
+    // 초기 상태 적재 / 필터 깊이 변경 시 재동기화
+    reg seeded;
+    reg [7:0] depth_prev;
+    wire resync = !seeded || (filter_depth != depth_prev);
 
-            if (Index_sum >= 3'd4) begin
-                Index_filtered <= 1'b1;
-            end else if (Index_sum <= 3'd1) begin
-                Index_filtered <= 1'b0;
-            end else begin
-                Index_filtered <= Index_filtered; // 이전 상태 유지
-            end
-        end    
+    always @(posedge clk or negedge reset_n) begin
+        if (!reset_n) begin
+            seeded <= 1'b0;
+            depth_prev <= 8'd0;
+        end else begin
+            if (sync_fill[1])
+                seeded <= 1'b1;
+            depth_prev <= filter_depth;
+        end
     end
 
-    // 동기화를 위한 3단 플립플롭 레지스터 선언
-    reg [2:0] A_sync;
-    reg [2:0] B_sync;
-    reg [2:0] Index_sync;
+    // 글리치 필터: 신호별로 filtered 와 다른 값이 filter_depth 클럭 연속이면 반영
+    reg [2:0] filtered;
+    reg [7:0] stable_cnt [0:2];
+    integer k;
 
-    // A, B, Index 신호 3단 동기화
     always @(posedge clk or negedge reset_n) begin
         if (!reset_n) begin
-            A_sync <= 3'b000;
-            B_sync <= 3'b000;
-            Index_sync <= 3'b000;
+            filtered <= 3'b000;
+            for (k = 0; k < 3; k = k + 1)
+                stable_cnt[k] <= 8'd0;
+        end else if (resync) begin
+            filtered <= sync;
+            for (k = 0; k < 3; k = k + 1)
+                stable_cnt[k] <= 8'd0;
         end else begin
-            A_sync <= {A_sync[1:0], A_filtered};
-            B_sync <= {B_sync[1:0], B_filtered};
-            Index_sync <= {Index_sync[1:0], Index_filtered};
+            for (k = 0; k < 3; k = k + 1) begin
+                if (sync[k] == filtered[k]) begin
+                    stable_cnt[k] <= 8'd0;
+                end else if (stable_cnt[k] + 8'd1 >= filter_depth) begin
+                    filtered[k] <= sync[k];
+                    stable_cnt[k] <= 8'd0;
+                end else begin
+                    stable_cnt[k] <= stable_cnt[k] + 8'd1;
+                end
+            end
         end
     end
 
-    // 위치 카운트 및 에러 플래그
-    reg signed [31:0] position_count;         
-    reg signed [31:0] prev_index_position;    
-    parameter signed PULSES_PER_REVOLUTION = 4096;     
-    parameter signed MAX_POSITION_ERROR = 100;
-    reg error_flag; // 에러 플래그    
-
+    // bypass 시 동기화 출력을 바로 사용 (필터 레지스터 1클럭 생략)
+    wire [2:0] fe = (filter_depth == 8'd0) ? sync : filtered;
+
+    reg [1:0] ab_prev;
+    reg index_prev;
+
+    // 전이 디코드: {A_prev, B_prev, A, B}
+    reg signed [1:0] step;
+    reg invalid;
+    always @(*) begin
+        step = 2'sd0;
+        invalid = 1'b0;
+        case ({ab_prev[0], ab_prev[1], fe[0], fe[1]})
+            4'b0010: step = 2'sd1;                                          // A 상승 (B=0), x1 엣지
+            4'b1000: step = -2'sd1;                                         // A 하강 (B=0), x1 엣지
+            4'b1101: step = (decode_mode != 2'd2) ? 2'sd1 : 2'sd0;          // A 하강 (B=1)
+            4'b0111: step = (decode_mode != 2'd2) ? -2'sd1 : 2'sd0;         // A 상승 (B=1)
+            4'b1011: step = (decode_mode == 2'd0) ? 2'sd1 : 2'sd0;          // B 상승 (A=1)
+            4'b0100: step = (decode_mode == 2'd0) ? 2'sd1 : 2'sd0;          // B 하강 (A=0)
+            4'b1110: step = (decode_mode == 2'd0) ? -2'sd1 : 2'sd0;         // B 하강 (A=1)
+            4'b0001: step = (decode_mode == 2'd0) ? -2'sd1 : 2'sd0;         // B 상승 (A=0)
+            4'b0011, 4'b1100, 4'b0110, 4'b1001: invalid = 1'b1;             // A, B 동시 변화
+            default: ;                                                      // 변화 없음
+        endcase
+    end
 
+    // Index 간격 검사 (|이동량| 이 0 ± tol 또는 cpr ± tol)
+    wire signed [63:0] index_delta = position64 - index_position;
+    wire [63:0] index_dist = index_delta[63] ? -index_delta : index_delta;
+    wire index_ok = (index_dist <= index_tol) ||
+                    ((index_dist + index_tol >= index_cpr) && (index_dist <= index_cpr + index_tol));
 
-    // 위치 카운트 계산 (동기화된 A, B 신호 사용)
     always @(posedge clk or negedge reset_n) begin
         if (!reset_n) begin
-            position_count <= 32'sd0;
-            prev_index_position <= 32'sd0;
-            actual_position <= 32'sd0;
-            error_flag <= 1'b0;
+            ab_prev <= 2'b00;
+            index_prev <= 1'b0;
+            position64 <= 64'sd0;
+            index_position <= 64'sd0;
+            index_seen <= 1'b0;
+            invalid_count <= 32'd0;
+            invalid_seen <= 1'b0;
+            index_error <= 1'b0;
+        end else if (resync) begin
+            // 현재 입력을 이전 상태로 적재 (카운트 / 검출 없음)
+            ab_prev <= sync[1:0];
+            index_prev <= sync[2];
+            if (status_clear) begin
+                invalid_count <= 32'd0;
+                invalid_seen <= 1'b0;
+                index_error <= 1'b0;
+                index_seen <= 1'b0;
+            end
         end else begin
-            // A, B 신호의 에지 검출을 통한 방향 결정
-            case ({A_sync[2], B_sync[2], A_sync[1], B_sync[1]})
-                4'b0010, 4'b1011, 4'b1101, 4'b0100: position_count <= position_count + 1; // CW 방향 증가
-                4'b0001, 4'b0111, 4'b1110, 4'b1000: position_count <= position_count - 1; // CCW 방향 감소
-                default: position_count <= position_count; // 변화 없음
-            endcase
-
-            // Index 신호의 rising edge 검출
-            if (Index_sync[2] && !Index_sync[1]) begin
-                if ((position_count - prev_index_position) > (PULSES_PER_REVOLUTION - MAX_POSITION_ERROR)) begin
-                    // 정방향 초과
-                    position_count <= prev_index_position + PULSES_PER_REVOLUTION;
-                    error_flag <= 1'b1;
-                end else if ((position_count - prev_index_position) < (-PULSES_PER_REVOLUTION + MAX_POSITION_ERROR)) begin
-                    // 역방향 초과
-                    position_count <= prev_index_position - PULSES_PER_REVOLUTION;
-                    error_flag <= 1'b1;
-                end else begin
-                    // 정상 범위 내
-                    error_flag <= 1'b0;
-                end
-                prev_index_position <= position_count; // Index 위치 업데이트
+            ab_prev <= fe[1:0];
+            index_prev <= fe[2];
+
+            position64 <= position64 + step;
+
+            if (status_clear) begin
+                invalid_count <= 32'd0;
+                invalid_seen <= 1'b0;
+                index_error <= 1'b0;
+                index_seen <= 1'b0;
+            end else if (invalid) begin
+                if (invalid_count != 32'hFFFFFFFF)
+                    invalid_count <= invalid_count + 1;
+                invalid_seen <= 1'b1;
             end
 
-            // 실제 위치 업데이트
-            actual_position <= position_count;
+            // Index 상승 엣지: 위치 래치 (같은 클럭의 카운트 변화 전 값)
+            if (fe[2] && !index_prev) begin
+                index_position <= position64;
+                if (!status_clear) begin
+                    index_seen <= 1'b1;
+                    if (index_seen && index_cpr != 16'd0 && !index_ok)
+                        index_error <= 1'b1;
+                end
+            end
         end
     end
 
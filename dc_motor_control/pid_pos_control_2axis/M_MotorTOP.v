@@ -13,13 +13,92 @@ module motor_top (
     output wire dir2,                       // 방향 제어 2
     output wire pwm_out,                    // PWM 출력
     output wire signed [15:0] pid_control_signal, // PI 제어 신호 출력
-    output wire signed [31:0] actual_position             // 실제 위치 출력
+    output wire signed [31:0] actual_position,            // 실제 위치 출력
+    output wire encoder_fault,              // 엔코더 error_flag (safety_supervisor)
+    input wire safe_tripped,                // safety_supervisor 트립 (출력 차단 중)
+
+    // 엔코더 프런트엔드 설정 / 상태 (AXI)
+    input wire [7:0] enc_filter_depth,
+    input wire [1:0] enc_decode_mode,
+    input wire enc_status_clear,
+    input wire [15:0] enc_index_cpr,
+    input wire [7:0] enc_index_tol,
+    output wire [31:0] enc_status,          // [2] Index 래치, [1] Index 간격 오류, [0] 무효 전이
+    output wire [31:0] enc_invalid_count,
+    output wire signed [63:0] enc_position64,
+    output wire signed [63:0] enc_index_position,
+
+    // 2자유도 PID (AXI). pid2_select = 0 이면 pi_velocity_controller 출력 사용
+    input wire pid2_select,
+    input wire pid2_clear,
+    input wire [15:0] pid2_d_alpha,
+    input wire [28:0] pid2_kp,
+    input wire [28:0] pid2_ki,
+    input wire [28:0] pid2_kd,
+    input wire [28:0] pid2_kt,
+    input wire [15:0] pid2_weight_p,
+    input wire [15:0] pid2_weight_d,
+    output wire signed [31:0] pid2_integ,
+
+    // 윤곽 제어 보정 (contour_coupler, 제어기 출력에 더함)
+    input wire signed [15:0] cc_correction,
+
+    // 텔레메트리 (pi_velocity_controller 참고)
+    output wire tlm_tick,                   // 제어 주기 갱신 완료 펄스
+    output wire signed [31:0] tlm_desired,  // 이번 틱 목표 위치
+    output wire signed [31:0] tlm_actual,   // 이번 틱 실제 위치
+    output wire signed [31:0] tlm_error,    // 이번 틱 오차
+
+    // biquad 캐스케이드 계수 / 상태 (AXI)
+    input wire bq_coef_we,
+    input wire [8:0] bq_coef_sel,
+    input wire [8:0] bq_coef_rsel,
+    input wire [31:0] bq_coef_wdata,
+    output wire [31:0] bq_coef_rdata,
+    input wire bq_commit,
+    input wire bq_commit_clear,
+    input wire [15:0] bq_enable_mask,
+    input wire [1:0] bq_sat_clear,
+    output wire [31:0] bq_status,           // [31] commit 대기, [17:2] 활성 마스크, [1:0] 포화
+
+    // 외란 관측기 설정 / 추정값 (AXI)
+    input wire dob_enable,
+    input wire dob_clear,
+    input wire [2:0] dob_vel_shift,
+    input wire [15:0] dob_alpha,
+    input wire [31:0] dob_k_j,
+    input wire [31:0] dob_b_n,
+    input wire [15:0] dob_limit,
+    output wire signed [31:0] dob_est
 );
 
     assign actual_position = encoder_position; // 엔코더 위치를 실제 위치로 설정
 
     // 내부 신호 정의
         wire signed [31:0] encoder_position;
+    wire signed [31:0] fb_filtered;         // 피드백 체인 출력 (틱마다 갱신)
+    wire signed [31:0] filtered_position;   // 제어기 위치 입력
+    wire signed [15:0] raw_control_signal;  // 선택된 제어기 출력 (DOB / 필터 전)
+    wire signed [15:0] cc_control_signal;   // 윤곽 보정 후
+    wire signed [15:0] pid1_control_signal; // pi_velocity_controller 출력
+    wire signed [15:0] pid2_control_signal; // pid_2dof_controller 출력
+    wire pid1_tick, pid2_tick;
+    wire signed [31:0] pid1_tlm_desired, pid1_tlm_actual, pid1_tlm_error;
+    wire signed [31:0] pid2_tlm_desired, pid2_tlm_actual, pid2_tlm_error;
+    wire signed [15:0] dob_control_signal;  // 외란 보상 후
+    wire pid_tick;
+    wire dob_done;
+    wire [15:0] bq_active_mask;
+    wire bq_commit_pending;
+    wire [1:0] bq_sat_flags;
+    wire enc_index_seen, enc_index_error, enc_invalid_seen;
+
+    assign enc_status = {29'd0, enc_index_seen, enc_index_error, enc_invalid_seen};
+
+    assign bq_status = {bq_commit_pending, 13'd0, bq_active_mask, bq_sat_flags};
+
+    // 피드백 단이 모두 bypass 면 엔코더를 직접 연결 (필터 경로의 1틱 지연 제거)
+    assign filtered_position = (bq_active_mask[15:8] != 8'd0) ? fb_filtered : encoder_position;
 
 
     // 쿼드러쳐 엔코더 모듈 인스턴스화
@@ -30,7 +109,19 @@ module motor_top (
         .A(encoder_a),                       // 엔코더 A 신호
         .B(encoder_b),                       // 엔코더 B 신호
         .Index(encoder_index),               // 엔코더 Index 신호
-        .actual_position(encoder_position)  // 위치 출력
+        .filter_depth(enc_filter_depth),
+        .decode_mode(enc_decode_mode),
+        .index_cpr(enc_index_cpr),
+        .index_tol(enc_index_tol),
+        .status_clear(enc_status_clear),
+        .actual_position(encoder_position), // 위치 출력 (64비트 위치 하위)
+        .position64(enc_position64),
+        .index_position(enc_index_position),
+        .index_seen(enc_index_seen),
+        .invalid_count(enc_invalid_count),
+        .invalid_seen(enc_invalid_seen),
+        .index_error(enc_index_error),
+        .error_flag(encoder_fault)           // 무효 전이 | Index 간격 오류
     );
 
     // PI velocity 컨트롤러 모듈 인스턴스화
@@ -39,12 +130,55 @@ module motor_top (
         .clk(clk),                       // 20 kHz 클럭
         .reset_n(reset_n),                   // 리셋 신호
         .desired_pos(desired_pos),           // 목표 위치
-        .actual_pos(encoder_position),       // 실제 위치
+        .actual_pos(filtered_position),      // 실제 위치 (피드백 필터 후, bypass 시 엔코더 그대로)
         .Kp_axi(Kp_axi),                   // Kp 값
         .Ki_axi(Ki_axi),                   // Ki 값
         .Kd_axi(Kd_axi),                   // Kd 값 (사용하지 않음)
-        .control_signal(pid_control_signal)   // PID 제어 신호 출력
+        .control_signal(pid1_control_signal),  // PID 제어 신호 출력
+        .integ_clear(safe_tripped),          // 트립 중 적분 누적 방지
+        .ctrl_tick(pid1_tick),
+        .tlm_desired(pid1_tlm_desired),
+        .tlm_actual(pid1_tlm_actual),
+        .tlm_error(pid1_tlm_error)
+    );
+
+    // 2자유도 PID: 항상 계산하고, 선택되지 않은 동안은 I 가 기존 제어기 출력을 따라간다
+    // 트립 중에는 선택 여부와 무관하게 0 을 따라가 재기동 시 누적된 출력이 나오지 않게 한다
+    (* dont_touch = "true" *)
+    pid_2dof_controller u_pid_2dof_controller (
+        .clk(clk),
+        .reset_n(reset_n),
+        .desired_pos(desired_pos),
+        .actual_pos(filtered_position),
+        .control_signal(pid2_control_signal),
+        .kp(pid2_kp),
+        .ki(pid2_ki),
+        .kd(pid2_kd),
+        .kt(pid2_kt),
+        .weight_p(pid2_weight_p),
+        .weight_d(pid2_weight_d),
+        .d_alpha(pid2_d_alpha),
+        .clear(pid2_clear),
+        .track(!pid2_select || safe_tripped),
+        .u_track(safe_tripped ? 16'sd0 : pid1_control_signal),
+        .integ(pid2_integ),
+        .ctrl_tick(pid2_tick),
+        .tlm_desired(pid2_tlm_desired),
+        .tlm_actual(pid2_tlm_actual),
+        .tlm_error(pid2_tlm_error)
     );
+
+    // 제어기 선택 (틱 / 텔레메트리도 같은 쪽을 따른다)
+    assign raw_control_signal = pid2_select ? pid2_control_signal : pid1_control_signal;
+    assign pid_tick = pid2_select ? pid2_tick : pid1_tick;
+    assign tlm_desired = pid2_select ? pid2_tlm_desired : pid1_tlm_desired;
+    assign tlm_actual = pid2_select ? pid2_tlm_actual : pid1_tlm_actual;
+    assign tlm_error = pid2_select ? pid2_tlm_error : pid1_tlm_error;
+
+    // 윤곽 보정 합 (±4000 포화). 보정은 직전 틱 값이라 pid_tick 시점에 이미 안정
+    wire signed [16:0] cc_sum = raw_control_signal + cc_correction;
+    assign cc_control_signal = (cc_sum > 17'sd4000) ? 16'sd4000 :
+                               (cc_sum < -17'sd4000) ? -16'sd4000 : cc_sum[15:0];
     // input wire clk,                      // 원래 클럭 (100mhz)
     // input wire reset_n,                  // 비동기 리셋 (Active Low)
     // input wire signed [31:0] desired_pos, // 목표 위치
@@ -65,6 +199,56 @@ module motor_top (
     //     .control_signal(pid_control_signal)  // PID 제어 신호 출력
     // );
 
+    // 외란 관측기: 제어기 출력에서 추정 부하 토크를 빼고 biquad 로 넘긴다
+    // u_applied 는 이번 틱 biquad 갱신 전의 PWM 입력 = 지난 틱 동안 실제 인가된 값
+    // 트립 중에는 브리지가 꺼져 있으므로 u = 0, 추정은 유지 (hold)
+    (* dont_touch = "true" *)
+    disturbance_observer u_disturbance_observer (
+        .clk(clk),
+        .reset_n(reset_n),
+        .start(pid_tick),
+        .position(encoder_position),
+        .u_applied(safe_tripped ? 16'sd0 : pid_control_signal),
+        .ctrl_in(cc_control_signal),
+        .ctrl_out(dob_control_signal),
+        .d_est(dob_est),
+        .done(dob_done),
+        .enable(dob_enable),
+        .clear(dob_clear),
+        .hold(safe_tripped),
+        .vel_shift(dob_vel_shift),
+        .alpha(dob_alpha),
+        .k_j(dob_k_j),
+        .b_n(dob_b_n),
+        .limit(dob_limit)
+    );
+
+    // 제어 출력 / 피드백 biquad 캐스케이드 (notch, low-pass)
+    // 필터 출력이 갱신된 시점을 텔레메트리 틱으로 사용 → 스냅샷의 control 이 PWM 입력과 일치
+    (* dont_touch = "true" *)
+    biquad_cascade u_biquad_cascade (
+        .clk(clk),
+        .reset_n(reset_n),
+        .start(dob_done),
+        .ctrl_in(dob_control_signal),
+        .fb_in(encoder_position),
+        .ctrl_out(pid_control_signal),
+        .fb_out(fb_filtered),
+        .done(tlm_tick),
+        .coef_we(bq_coef_we),
+        .coef_sel(bq_coef_sel),
+        .coef_rsel(bq_coef_rsel),
+        .coef_wdata(bq_coef_wdata),
+        .coef_rdata(bq_coef_rdata),
+        .commit(bq_commit),
+        .commit_clear(bq_commit_clear),
+        .enable_mask(bq_enable_mask),
+        .sat_clear(bq_sat_clear),
+        .active_mask(bq_active_mask),
+        .commit_pending(bq_commit_pending),
+        .sat_flags(bq_sat_flags)
+    );
+
     // PWM 생성기 모듈 인스턴스화
     (* dont_touch = "true" *)
     pwm_generator_bidirectional u_pwm_generator (
@@ -4,7 +4,7 @@ module maxon_top (
     // AXI Interface
     input wire s00_axi_aclk,
     input wire s00_axi_aresetn,
-    input wire [3:0] s00_axi_awaddr,
+    input wire [7:0] s00_axi_awaddr,
     input wire [2:0] s00_axi_awprot,
     input wire s00_axi_awvalid,
     output wire s00_axi_awready,
@@ -15,7 +15,7 @@ module maxon_top (
     output wire [1:0] s00_axi_bresp,
     output wire s00_axi_bvalid,
     input wire s00_axi_bready,
-    input wire [3:0] s00_axi_araddr,
+    input wire [7:0] s00_axi_araddr,
     input wire [2:0] s00_axi_arprot,
     input wire s00_axi_arvalid,
     output wire s00_axi_arready,
@@ -34,6 +34,26 @@ module maxon_top (
     output wire dir2,                // 방향 제어 2
     output wire pwm_out,             // PWM 출력
 
+    // 텔레메트리 출력 (telemetry_axis 로 연결)
+    output wire tlm_tick,                       // 제어 주기 갱신 완료 펄스
+    output wire signed [31:0] tlm_desired,      // 목표 위치
+    output wire signed [31:0] tlm_actual,       // 실제 위치
+    output wire signed [31:0] tlm_error,        // 위치 오차
+    output wire signed [15:0] tlm_control,      // 제어 신호
+    output wire signed [31:0] tlm_disturbance,  // 추정 외란 (DOB)
+
+    // 윤곽 제어 (contour_coupler 와 연결). 설정은 축 0 인스턴스 것만 사용, 상태는 두 축에 같이 연결
+    output wire cc_enable,
+    output wire cc_clear,
+    output wire [2:0] cc_vel_shift,
+    output wire [28:0] cc_gain,
+    output wire [15:0] cc_limit,
+    output wire [15:0] cc_min_speed,
+    input wire signed [15:0] cc_correction,     // 이 축 보정 (corr_x / corr_y)
+    input wire signed [31:0] cc_contour_err,
+    input wire [31:0] cc_contour_peak,
+    input wire cc_dir_valid,
+
     // 디버깅 LED 출력
     output reg [1:0] led            // LED 디버깅 출력
     // output reg [3:0] led             // LED 디버깅 출력
@@ -47,17 +67,187 @@ module maxon_top (
     wire signed [31:0] actual_pos;    // 실제 위치
     wire signed [15:0] internal_control_signal; // 내부 제어 신호
 
+    assign tlm_control = internal_control_signal;
+
+    // 상태 스냅샷 (제어 틱마다 한 번에 래치)
+    wire [63:0] ts_now;
+    wire [63:0] snap_ts;
+    wire [31:0] snap_tick;
+    wire [31:0] snap_desired;
+    wire [31:0] snap_actual;
+    wire [31:0] snap_error;
+    wire [31:0] snap_control;
+    wire [31:0] snap_flags;
+    wire [31:0] status_flags;
+
+    // biquad 계수 / 상태 (AXI ↔ motor_top)
+    wire bq_coef_we;
+    wire [8:0] bq_coef_sel;
+    wire [8:0] bq_coef_rsel;
+    wire [31:0] bq_coef_wdata;
+    wire [31:0] bq_coef_rdata;
+    wire bq_commit;
+    wire bq_commit_clear;
+    wire [15:0] bq_enable_mask;
+    wire [1:0] bq_sat_clear;
+    wire [31:0] bq_status;
+
+    // 외란 관측기 설정 (AXI → motor_top)
+    wire dob_enable;
+    wire dob_clear;
+    wire [2:0] dob_vel_shift;
+    wire [15:0] dob_alpha;
+    wire [31:0] dob_k_j;
+    wire [31:0] dob_b_n;
+    wire [15:0] dob_limit;
+
+    // 안전 감시기 (AXI ↔ safety_supervisor)
+    wire [4:0] safe_mask;
+    wire safe_brake;
+    wire safe_clear;
+    wire safe_force_trip;
+    wire [31:0] safe_follow;
+    wire [15:0] safe_speed;
+    wire [15:0] safe_sat_ticks;
+    wire [30:0] safe_wd_timeout;
+    wire safe_wd_kick;
+    wire safe_tripped;
+    wire [5:0] safe_fault_latched;
+    wire [5:0] safe_fault_live;
+    wire [63:0] safe_trip_ts;
+    wire [31:0] safe_status;
+    wire encoder_fault;
+    wire motor_dir1, motor_dir2, motor_pwm;     // PWM 생성기 출력 (게이트 전)
+
+    assign safe_status = {safe_tripped, 17'd0, safe_fault_live, 2'd0, safe_fault_latched};
+
+    // 엔코더 프런트엔드 설정 / 상태 (AXI ↔ motor_top)
+    wire [7:0] enc_filter_depth;
+    wire [1:0] enc_decode_mode;
+    wire enc_status_clear;
+    wire [15:0] enc_index_cpr;
+    wire [7:0] enc_index_tol;
+    wire [31:0] enc_status;
+    wire [31:0] enc_invalid_count;
+    wire [63:0] enc_position64;
+    wire [63:0] enc_index_position;
+
+    // 2자유도 PID 설정 (AXI → motor_top)
+    wire pid2_select;
+    wire pid2_clear;
+    wire [15:0] pid2_d_alpha;
+    wire [28:0] pid2_kp;
+    wire [28:0] pid2_ki;
+    wire [28:0] pid2_kd;
+    wire [28:0] pid2_kt;
+    wire [15:0] pid2_weight_p;
+    wire [15:0] pid2_weight_d;
+    wire [31:0] pid2_integ;
+
+    // 윤곽 제어 상태 (AXI RO): [16] 방향 확보, [15:0] 이 축 보정
+    wire [31:0] cc_status;
+
+    assign cc_status = {15'd0, cc_dir_valid, cc_correction};
+
+    // [0] 제어 신호 포화, [1] dir1, [2] dir2, [3] 안전 트립
+    assign status_flags = {28'd0, safe_tripped, dir2, dir1,
+                           (internal_control_signal >= 16'sd4000 || internal_control_signal <= -16'sd4000)};
+
+    (* dont_touch = "true" *)
+    status_snapshot u_status_snapshot (
+        .clk(clk),
+        .reset_n(reset_n),
+        .tick(tlm_tick),
+        .desired(tlm_desired),
+        .actual(tlm_actual),
+        .error(tlm_error),
+        .control(internal_control_signal),
+        .flags(status_flags),
+        .ts_now(ts_now),
+        .snap_ts(snap_ts),
+        .snap_tick(snap_tick),
+        .snap_desired(snap_desired),
+        .snap_actual(snap_actual),
+        .snap_error(snap_error),
+        .snap_control(snap_control),
+        .snap_flags(snap_flags)
+    );
+
     // AXI 슬레이브 모듈 인스턴스화
     (* dont_touch = "true" *)
     myip_v1_0 #(
         .C_S00_AXI_DATA_WIDTH(32),
-        .C_S00_AXI_ADDR_WIDTH(4)
+        .C_S00_AXI_ADDR_WIDTH(8)
     ) u_myip_v1_0 (
         .kp_init(kp_init),
         .ki_init(ki_init),
         .desired_pos(desired_pos),
         .kd_init(kd_init),
         .actual_pos(actual_pos), // 실제 위치
+        .snap_ts(snap_ts),
+        .snap_tick(snap_tick),
+        .snap_desired(snap_desired),
+        .snap_actual(snap_actual),
+        .snap_error(snap_error),
+        .snap_control(snap_control),
+        .snap_flags(snap_flags),
+        .bq_coef_we(bq_coef_we),
+        .bq_coef_sel(bq_coef_sel),
+        .bq_coef_rsel(bq_coef_rsel),
+        .bq_coef_wdata(bq_coef_wdata),
+        .bq_coef_rdata(bq_coef_rdata),
+        .bq_commit(bq_commit),
+        .bq_commit_clear(bq_commit_clear),
+        .bq_enable_mask(bq_enable_mask),
+        .bq_sat_clear(bq_sat_clear),
+        .bq_status(bq_status),
+        .dob_enable(dob_enable),
+        .dob_clear(dob_clear),
+        .dob_vel_shift(dob_vel_shift),
+        .dob_alpha(dob_alpha),
+        .dob_k_j(dob_k_j),
+        .dob_b_n(dob_b_n),
+        .dob_limit(dob_limit),
+        .dob_est(tlm_disturbance),
+        .safe_mask(safe_mask),
+        .safe_brake(safe_brake),
+        .safe_clear(safe_clear),
+        .safe_force_trip(safe_force_trip),
+        .safe_follow(safe_follow),
+        .safe_speed(safe_speed),
+        .safe_sat_ticks(safe_sat_ticks),
+        .safe_wd_timeout(safe_wd_timeout),
+        .safe_wd_kick(safe_wd_kick),
+        .safe_status(safe_status),
+        .safe_trip_ts(safe_trip_ts),
+        .enc_filter_depth(enc_filter_depth),
+        .enc_decode_mode(enc_decode_mode),
+        .enc_status_clear(enc_status_clear),
+        .enc_index_cpr(enc_index_cpr),
+        .enc_index_tol(enc_index_tol),
+        .enc_status(enc_status),
+        .enc_invalid_count(enc_invalid_count),
+        .enc_position64(enc_position64),
+        .enc_index_position(enc_index_position),
+        .pid2_select(pid2_select),
+        .pid2_clear(pid2_clear),
+        .pid2_d_alpha(pid2_d_alpha),
+        .pid2_kp(pid2_kp),
+        .pid2_ki(pid2_ki),
+        .pid2_kd(pid2_kd),
+        .pid2_kt(pid2_kt),
+        .pid2_weight_p(pid2_weight_p),
+        .pid2_weight_d(pid2_weight_d),
+        .pid2_integ(pid2_integ),
+        .cc_enable(cc_enable),
+        .cc_clear(cc_clear),
+        .cc_vel_shift(cc_vel_shift),
+        .cc_gain(cc_gain),
+        .cc_limit(cc_limit),
+        .cc_min_speed(cc_min_speed),
+        .cc_err(cc_contour_err),
+        .cc_peak(cc_contour_peak),
+        .cc_status(cc_status),
 
         .s00_axi_aclk(s00_axi_aclk),
         .s00_axi_aresetn(s00_axi_aresetn),
@@ -95,10 +285,86 @@ module maxon_top (
         .Kd_axi(kd_init),              // AXI로부터 전달받은 Kd 값
         .desired_pos(desired_pos),     // AXI로부터 전달받은 목표 속도도
         .actual_position(actual_pos),  // 실제 위치 출력
-        .dir1(dir1),                   // 방향 제어 1
-        .dir2(dir2),                   // 방향 제어 2
+        .encoder_fault(encoder_fault),
+        .safe_tripped(safe_tripped),   // 트립 중 DOB / 적분 누적 정지
+        .enc_filter_depth(enc_filter_depth),
+        .enc_decode_mode(enc_decode_mode),
+        .enc_status_clear(enc_status_clear),
+        .enc_index_cpr(enc_index_cpr),
+        .enc_index_tol(enc_index_tol),
+        .enc_status(enc_status),
+        .enc_invalid_count(enc_invalid_count),
+        .enc_position64(enc_position64),
+        .enc_index_position(enc_index_position),
+        .pid2_select(pid2_select),
+        .pid2_clear(pid2_clear),
+        .pid2_d_alpha(pid2_d_alpha),
+        .pid2_kp(pid2_kp),
+        .pid2_ki(pid2_ki),
+        .pid2_kd(pid2_kd),
+        .pid2_kt(pid2_kt),
+        .pid2_weight_p(pid2_weight_p),
+        .pid2_weight_d(pid2_weight_d),
+        .pid2_integ(pid2_integ),
+        .cc_correction(cc_correction),
+        .dir1(motor_dir1),             // 방향 제어 1 (안전 게이트 전)
+        .dir2(motor_dir2),             // 방향 제어 2 (안전 게이트 전)
         .pid_control_signal(internal_control_signal), // 디버깅: 제어 신호
-        .pwm_out(pwm_out)              // PWM 출력
+        .pwm_out(motor_pwm),           // PWM 출력 (안전 게이트 전)
+        .tlm_tick(tlm_tick),
+        .tlm_desired(tlm_desired),
+        .tlm_actual(tlm_actual),
+        .tlm_error(tlm_error),
+        .bq_coef_we(bq_coef_we),
+        .bq_coef_sel(bq_coef_sel),
+        .bq_coef_rsel(bq_coef_rsel),
+        .bq_coef_wdata(bq_coef_wdata),
+        .bq_coef_rdata(bq_coef_rdata),
+        .bq_commit(bq_commit),
+        .bq_commit_clear(bq_commit_clear),
+        .bq_enable_mask(bq_enable_mask),
+        .bq_sat_clear(bq_sat_clear),
+        .bq_status(bq_status),
+        .dob_enable(dob_enable),
+        .dob_clear(dob_clear),
+        .dob_vel_shift(dob_vel_shift),
+        .dob_alpha(dob_alpha),
+        .dob_k_j(dob_k_j),
+        .dob_b_n(dob_b_n),
+        .dob_limit(dob_limit),
+        .dob_est(tlm_disturbance)
+    );
+
+    // 안전 감시기: PS 와 무관하게 클럭 단위로 트립, 출력 핀 직전에서 PWM 차단 / 제동
+    (* dont_touch = "true" *)
+    safety_supervisor u_safety_supervisor (
+        .clk(clk),
+        .reset_n(reset_n),
+        .tick(tlm_tick),
+        .desired(desired_pos),
+        .position(actual_pos),
+        .control(internal_control_signal),
+        .encoder_fault(encoder_fault),
+        .ts_now(ts_now),
+        .enable_mask(safe_mask),
+        .brake(safe_brake),
+        .follow_limit(safe_follow),
+        .speed_limit(safe_speed),
+        .sat_ticks(safe_sat_ticks),
+        .wd_timeout(safe_wd_timeout),
+        .wd_kick(safe_wd_kick),
+        .force_trip(safe_force_trip),
+        .clear(safe_clear),
+        .dir1_in(motor_dir1),
+        .dir2_in(motor_dir2),
+        .pwm_in(motor_pwm),
+        .dir1_out(dir1),
+        .dir2_out(dir2),
+        .pwm_out(pwm_out),
+        .tripped(safe_tripped),
+        .fault_latched(safe_fault_latched),
+        .fault_live(safe_fault_live),
+        .trip_ts(safe_trip_ts)
     );
 
     // LED 디버깅 출력 연결
@@ -0,0 +1,242 @@
+`timescale 1ns / 1ps
+
+// 2자유도 PID 위치 제어기 (pi_velocity_controller 대체 경로, motor_top 에서 AXI 로 선택)
+//
+//   e_p = b * r - y                 (P 항 목표 가중치)
+//   e_d = c * r - y                 (D 항 목표 가중치, c = 0 이면 측정값 미분 → 목표 스텝에서 D 킥 없음)
+//   D   = Kd * LPF(e_d[k] - e_d[k-1])       (1차 저역 통과, 계수 alpha, alpha = 0 이면 필터 없음)
+//   v   = Kp * e_p + I + D,  u = sat(v, ±CTRL_LIMIT)
+//   I  += Ki * (r - y) + Kt * (u_ref - v)  (back-calculation anti-windup, |I| <= CTRL_LIMIT)
+//
+// 게인은 24비트 가수 + 5비트 시프트 (gain = M / 2^E). Q7.8 값 q 는 M = q, E = 8 과 같다.
+// I 는 제어 신호 단위로 저장하므로 Ki 는 (제어 단위 / 카운트) / 틱, Kt 는 틱당 비율 (0 ~ 1).
+// 내부 합은 Q16 (64비트) 로 두어 작은 Ki 의 누적이 버려지지 않는다.
+//
+// 선택되지 않은 동안에도 매 틱 계산하며, back-calculation 기준을 u_track (실제 사용 중인 제어기 출력) 으로
+// 바꿔 I 가 그 출력을 따라가게 한다 (전환 시 출력 점프 감소).
+// 제어 틱마다 8사이클 후 ctrl_tick 펄스 (control_signal, 텔레메트리 갱신). clear 는 다음 틱에 적용된다.
+
+module pid_2dof_controller #(
+    parameter DIVIDER = 5000,                 // 100MHz / 20kHz
+    parameter signed [31:0] CTRL_LIMIT = 32'sd4000
+)(
+    input wire clk,                           // 100 MHz 시스템 클럭
+    input wire reset_n,                       // 리셋 신호 (Active Low)
+    input wire signed [31:0] desired_pos,     // 목표 위치
+    input wire signed [31:0] actual_pos,      // 실제 위치
+    output reg signed [15:0] control_signal,  // 제어 신호 출력
+
+    // 설정 (AXI)
+    input wire [28:0] kp,                     // [23:0] 가수, [28:24] 시프트
+    input wire [28:0] ki,
+    input wire [28:0] kd,
+    input wire [28:0] kt,                     // anti-windup 추적 게인
+    input wire [15:0] weight_p,               // b (Q1.15, 0x8000 = 1.0)
+    input wire [15:0] weight_d,               // c (Q1.15)
+    input wire [15:0] d_alpha,                // D 필터 계수 Q0.16 = 1 - exp(-2*pi*fc/fs), 0 = 필터 없음
+    input wire clear,                         // I / D 필터 상태 초기화 펄스
+    input wire track,                         // 1: 비선택, I 가 u_track 을 따라감
+    input wire signed [15:0] u_track,         // 사용 중인 제어기 출력
+    output wire signed [31:0] integ,          // I 상태 (Q16.16 제어 단위)
+
+    // 텔레메트리 (pi_velocity_controller 와 같음)
+    output reg ctrl_tick,
+    output wire signed [31:0] tlm_desired,
+    output wire signed [31:0] tlm_actual,
+    output wire signed [31:0] tlm_error
+);
+
+    localparam signed [63:0] TERM_MAX = 64'sh1FFFFFFFFFFFFFFF;   // 세 항의 합이 넘치지 않도록 항마다 제한 (2*2^61 + I_MAX < 2^63)
+    localparam signed [63:0] I_MAX = {{16{CTRL_LIMIT[31]}}, CTRL_LIMIT, 16'd0};
+
+    localparam [3:0] S_IDLE = 4'd0,
+                     S_ERR  = 4'd1,
+                     S_DIFF = 4'd2,
+                     S_DF   = 4'd3,
+                     S_MP   = 4'd4,
+                     S_MD   = 4'd5,
+                     S_MI   = 4'd6,
+                     S_SUM  = 4'd7,
+                     S_OUT  = 4'd8,
+                     S_INT  = 4'd9;
+
+    // 100MHz → 20kHz 분주 (pi_velocity_controller 와 같은 위상)
+    reg [12:0] clk_div_counter;
+    always @(posedge clk or negedge reset_n) begin
+        if (!reset_n)
+            clk_div_counter <= 0;
+        else if (clk_div_counter == DIVIDER - 1)
+            clk_div_counter <= 0;
+        else
+            clk_div_counter <= clk_div_counter + 1;
+    end
+
+    reg [3:0] state;
+    reg clear_pending;
+    reg primed;                               // e_d_prev 유효 (첫 틱 D 킥 방지)
+
+    reg signed [31:0] r, y;
+    reg signed [32:0] e;
+    reg signed [34:0] e_p, e_d, e_d_prev;     // 가중치 최대 2 → 34비트 + 부호
+    reg signed [35:0] d_raw;
+    reg signed [63:0] df;                     // 필터된 e_d 변화량 (Q16)
+    reg signed [63:0] p_term, d_term, ki_term, v;
+    reg signed [63:0] i_state;                // Q16
+    reg signed [15:0] u_ref;
+    reg signed [87:0] prod;                   // 가수 x Q16 피연산자
+    reg [4:0] prod_shift;
+
+    assign tlm_desired = r;
+    assign tlm_actual = y;
+    assign tlm_error = e[31:0];
+    assign integ = i_state[31:0];
+
+    // 가중치 곱 (Q1.15, 반올림)
+    wire signed [16:0] wp_s = $signed({1'b0, weight_p});
+    wire signed [16:0] wd_s = $signed({1'b0, weight_d});
+    wire signed [48:0] r_wp = (wp_s * r + 49'sd16384) >>> 15;
+    wire signed [48:0] r_wd = (wd_s * r + 49'sd16384) >>> 15;
+
+    // Q16 피연산자
+    wire signed [63:0] e_q16 = {{15{e[32]}}, e, 16'd0};
+    wire signed [63:0] e_p_q16 = {{13{e_p[34]}}, e_p, 16'd0};
+    wire signed [63:0] aw_q16 = {{32{u_ref[15]}}, u_ref, 16'd0} - v;
+
+    // D 필터: df += alpha * (d_raw - df)
+    wire signed [63:0] d_raw_q16 = {{12{d_raw[35]}}, d_raw, 16'd0};
+    wire signed [16:0] alpha_s = $signed({1'b0, d_alpha});
+    wire signed [80:0] df_step = alpha_s * (d_raw_q16 - df);
+
+    // 가수 x 피연산자 → 시프트 → 항 제한
+    wire signed [87:0] prod_sh = prod >>> prod_shift;
+    wire signed [63:0] term = (prod_sh > TERM_MAX) ? TERM_MAX :
+                              (prod_sh < -TERM_MAX) ? -TERM_MAX : prod_sh[63:0];
+
+    function signed [87:0] mul_gain;
+        input [28:0] g;
+        input signed [63:0] x;
+        mul_gain = $signed({1'b0, g[23:0]}) * x;
+    endfunction
+
+    // 출력 포화 (반올림)
+    wire signed [63:0] v_round = (v + 64'sd32768) >>> 16;
+    wire signed [15:0] u_sat = (v_round > CTRL_LIMIT) ? CTRL_LIMIT[15:0] :
+                               (v_round < -CTRL_LIMIT) ? -CTRL_LIMIT[15:0] : v_round[15:0];
+
+    // I 갱신 (제한)
+    wire signed [65:0] i_next = i_state + ki_term + term;
+    wire signed [63:0] i_sat = (i_next > I_MAX) ? I_MAX :
+                               (i_next < -I_MAX) ? -I_MAX : i_next[63:0];
+
+    always @(posedge clk or negedge reset_n) begin
+        if (!reset_n) begin
+            state <= S_IDLE;
+            clear_pending <= 1'b0;
+            primed <= 1'b0;
+            r <= 32'sd0;
+            y <= 32'sd0;
+            e <= 33'sd0;
+            e_p <= 35'sd0;
+            e_d <= 35'sd0;
+            e_d_prev <= 35'sd0;
+            d_raw <= 36'sd0;
+            df <= 64'sd0;
+            p_term <= 64'sd0;
+            d_term <= 64'sd0;
+            ki_term <= 64'sd0;
+            v <= 64'sd0;
+            i_state <= 64'sd0;
+            u_ref <= 16'sd0;
+            prod <= 88'sd0;
+            prod_shift <= 5'd0;
+            control_signal <= 16'sd0;
+            ctrl_tick <= 1'b0;
+        end else begin
+            ctrl_tick <= 1'b0;
+            if (clear)
+                clear_pending <= 1'b1;
+
+            case (state)
+                S_IDLE: begin
+                    if (clk_div_counter == 0) begin
+                        r <= desired_pos;
+                        y <= actual_pos;
+                        if (clear_pending) begin
+                            clear_pending <= clear;
+                            primed <= 1'b0;
+                            df <= 64'sd0;
+                            i_state <= 64'sd0;
+                        end
+                        state <= S_ERR;
+                    end
+                end
+
+                S_ERR: begin
+                    e <= r - y;
+                    e_p <= r_wp - y;
+                    e_d <= r_wd - y;
+                    state <= S_DIFF;
+                end
+
+                S_DIFF: begin
+                    d_raw <= primed ? e_d - e_d_prev : 36'sd0;
+                    e_d_prev <= e_d;
+                    primed <= 1'b1;
+                    state <= S_DF;
+                end
+
+                S_DF: begin
+                    if (d_alpha == 16'd0)
+                        df <= d_raw_q16;
+                    else
+                        df <= df + (df_step >>> 16);
+                    prod <= mul_gain(kp, e_p_q16);
+                    prod_shift <= kp[28:24];
+                    state <= S_MP;
+                end
+
+                S_MP: begin
+                    p_term <= term;
+                    prod <= mul_gain(kd, df);
+                    prod_shift <= kd[28:24];
+                    state <= S_MD;
+                end
+
+                S_MD: begin
+                    d_term <= term;
+                    prod <= mul_gain(ki, e_q16);
+                    prod_shift <= ki[28:24];
+                    state <= S_MI;
+                end
+
+                S_MI: begin
+                    ki_term <= term;
+                    v <= p_term + d_term + i_state;
+                    state <= S_SUM;
+                end
+
+                S_SUM: begin
+                    // 선택 중이면 자기 포화 출력, 아니면 사용 중인 출력을 기준으로 추적
+                    u_ref <= track ? u_track : u_sat;
+                    control_signal <= u_sat;
+                    ctrl_tick <= 1'b1;
+                    state <= S_OUT;
+                end
+
+                S_OUT: begin
+                    prod <= mul_gain(kt, aw_q16);
+                    prod_shift <= kt[28:24];
+                    state <= S_INT;
+                end
+
+                S_INT: begin
+                    i_state <= i_sat;
+                    state <= S_IDLE;
+                end
+
+                default: state <= S_IDLE;
+            endcase
+        end
+    end
+
+endmodule
@@ -8,8 +8,16 @@ module pi_velocity_controller (
     input wire [15:0] Kp_axi,             // 비례 게인
     input wire [15:0] Ki_axi,             // 적분 게인
     input wire [15:0] Kd_axi,             // 미분 게인
-    output reg signed [15:0] control_signal // PID 제어 신호 출력
-
+    output reg signed [15:0] control_signal, // PID 제어 신호 출력
+    input wire integ_clear,               // 1 인 동안 적분 0 (안전 트립 중 누적 방지)
+
+    // 텔레메트리 (ctrl_tick 이 1 인 사이클에 이번 틱의 값이 유효)
+    // desired / actual / error 는 같은 틱 래치 값. control_signal 은 파이프라인 (오차 → 곱 → 합 → 시프트 → 포화)
+    // 때문에 5틱 전 desired / actual 로 계산된 값이다.
+    output reg ctrl_tick,                     // 제어 주기 갱신 완료 펄스
+    output wire signed [31:0] tlm_desired,    // 이번 틱 목표 위치
+    output wire signed [31:0] tlm_actual,     // 이번 틱 실제 위치
+    output wire signed [31:0] tlm_error       // 이번 틱 오차 (tlm_desired - tlm_actual, 다음 틱 PID 입력)
 );
  
     // 100MHz → 20kHz 분주기용 Enable 신호 생성
@@ -29,6 +37,14 @@ module pi_velocity_controller (
     end
 
     assign clk_20k_enable = (clk_div_counter == 0);
+
+    // 모든 제어 레지스터는 clk_20k_enable 에서 갱신되므로 한 사이클 뒤에 텔레메트리 유효
+    always @(posedge clk or negedge reset_n) begin
+        if (!reset_n)
+            ctrl_tick <= 1'b0;
+        else
+            ctrl_tick <= clk_20k_enable;
+    end
     
     // PID 제어 변수
     reg signed [31:0] error_pos;
@@ -46,6 +62,10 @@ module pi_velocity_controller (
     reg signed [31:0] actual_pos_ff; // 실제 위치
     reg signed [31:0] desired_pos_ff; // 목표 위치
 
+    assign tlm_desired = desired_pos_ff;
+    assign tlm_actual  = actual_pos_ff;
+    assign tlm_error   = desired_pos_ff - actual_pos_ff;
+
     // 오차 계산 
     always @(posedge clk or negedge reset_n) begin
         if (!reset_n) begin
@@ -77,7 +97,9 @@ module pi_velocity_controller (
             integral <= 32'sd0;
         end else begin
             if (clk_20k_enable) begin
-                if (control_signal >= 16'sd3900 || control_signal <= -16'sd3900) begin
+                if (integ_clear) begin
+                    integral <= 32'sd0;
+                end else if (control_signal >= 16'sd3900 || control_signal <= -16'sd3900) begin
                     integral <= integral;
                 end else if (error_pos < 100 && error_pos > -100) begin
                     integral <= integral - (integral >>> 6); 
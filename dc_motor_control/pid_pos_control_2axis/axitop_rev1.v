@@ -4,7 +4,7 @@ module myip_v1_0 #
 (
     // Parameters for AXI Slave Bus Interface S00_AXI
     parameter integer C_S00_AXI_DATA_WIDTH = 32,
-    parameter integer C_S00_AXI_ADDR_WIDTH = 4
+    parameter integer C_S00_AXI_ADDR_WIDTH = 8
 )
 (
     // User-defined ports
@@ -14,6 +14,84 @@ module myip_v1_0 #
     input signed  [31:0] actual_pos,        // 실제 위치
     output signed [31:0] desired_pos,       // 목표 위치
 
+    // 상태 스냅샷 페이지 (status_snapshot)
+    input [63:0] snap_ts,           // 틱 타임스탬프 (10 ns)
+    input [31:0] snap_tick,         // 틱 카운터
+    input [31:0] snap_desired,      // 목표 위치
+    input [31:0] snap_actual,       // 실제 위치
+    input [31:0] snap_error,        // 위치 오차
+    input [31:0] snap_control,      // 제어 신호
+    input [31:0] snap_flags,        // 상태 플래그
+
+    // biquad 캐스케이드 (biquad_cascade)
+    output bq_coef_we,
+    output [8:0] bq_coef_sel,
+    output [8:0] bq_coef_rsel,
+    output [31:0] bq_coef_wdata,
+    input [31:0] bq_coef_rdata,
+    output bq_commit,
+    output bq_commit_clear,
+    output [15:0] bq_enable_mask,
+    output [1:0] bq_sat_clear,
+    input [31:0] bq_status,
+
+    // 외란 관측기 (disturbance_observer)
+    output dob_enable,
+    output dob_clear,
+    output [2:0] dob_vel_shift,
+    output [15:0] dob_alpha,
+    output [31:0] dob_k_j,
+    output [31:0] dob_b_n,
+    output [15:0] dob_limit,
+    input [31:0] dob_est,
+
+    // 안전 감시기 (safety_supervisor)
+    output [4:0] safe_mask,
+    output safe_brake,
+    output safe_clear,
+    output safe_force_trip,
+    output [31:0] safe_follow,
+    output [15:0] safe_speed,
+    output [15:0] safe_sat_ticks,
+    output [30:0] safe_wd_timeout,
+    output safe_wd_kick,
+    input [31:0] safe_status,
+    input [63:0] safe_trip_ts,
+
+    // 엔코더 프런트엔드 (quadrature_encoder)
+    output [7:0] enc_filter_depth,
+    output [1:0] enc_decode_mode,
+    output enc_status_clear,
+    output [15:0] enc_index_cpr,
+    output [7:0] enc_index_tol,
+    input [31:0] enc_status,
+    input [31:0] enc_invalid_count,
+    input [63:0] enc_position64,
+    input [63:0] enc_index_position,
+
+    // 2자유도 PID (pid_2dof_controller)
+    output pid2_select,
+    output pid2_clear,
+    output [15:0] pid2_d_alpha,
+    output [28:0] pid2_kp,
+    output [28:0] pid2_ki,
+    output [28:0] pid2_kd,
+    output [28:0] pid2_kt,
+    output [15:0] pid2_weight_p,
+    output [15:0] pid2_weight_d,
+    input [31:0] pid2_integ,
+
+    // 윤곽 제어 (contour_coupler)
+    output cc_enable,
+    output cc_clear,
+    output [2:0] cc_vel_shift,
+    output [28:0] cc_gain,
+    output [15:0] cc_limit,
+    output [15:0] cc_min_speed,
+    input [31:0] cc_err,
+    input [31:0] cc_peak,
+    input [31:0] cc_status,
+
     // AXI Slave Bus Interface S00_AXI ports
     input wire s00_axi_aclk,
     input wire s00_axi_aresetn,
@@ -49,6 +127,70 @@ module myip_v1_0 #
         .kd_init(kd_init),               // Kd 초기 값
         .desired_pos(desired_pos),       // 목표 위치
         .actual_pos(actual_pos),         // 실제 위치
+        .snap_ts(snap_ts),
+        .snap_tick(snap_tick),
+        .snap_desired(snap_desired),
+        .snap_actual(snap_actual),
+        .snap_error(snap_error),
+        .snap_control(snap_control),
+        .snap_flags(snap_flags),
+        .bq_coef_we(bq_coef_we),
+        .bq_coef_sel(bq_coef_sel),
+        .bq_coef_rsel(bq_coef_rsel),
+        .bq_coef_wdata(bq_coef_wdata),
+        .bq_coef_rdata(bq_coef_rdata),
+        .bq_commit(bq_commit),
+        .bq_commit_clear(bq_commit_clear),
+        .bq_enable_mask(bq_enable_mask),
+        .bq_sat_clear(bq_sat_clear),
+        .bq_status(bq_status),
+        .dob_enable(dob_enable),
+        .dob_clear(dob_clear),
+        .dob_vel_shift(dob_vel_shift),
+        .dob_alpha(dob_alpha),
+        .dob_k_j(dob_k_j),
+        .dob_b_n(dob_b_n),
+        .dob_limit(dob_limit),
+        .dob_est(dob_est),
+        .safe_mask(safe_mask),
+        .safe_brake(safe_brake),
+        .safe_clear(safe_clear),
+        .safe_force_trip(safe_force_trip),
+        .safe_follow(safe_follow),
+        .safe_speed(safe_speed),
+        .safe_sat_ticks(safe_sat_ticks),
+        .safe_wd_timeout(safe_wd_timeout),
+        .safe_wd_kick(safe_wd_kick),
+        .safe_status(safe_status),
+        .safe_trip_ts(safe_trip_ts),
+        .enc_filter_depth(enc_filter_depth),
+        .enc_decode_mode(enc_decode_mode),
+        .enc_status_clear(enc_status_clear),
+        .enc_index_cpr(enc_index_cpr),
+        .enc_index_tol(enc_index_tol),
+        .enc_status(enc_status),
+        .enc_invalid_count(enc_invalid_count),
+        .enc_position64(enc_position64),
+        .enc_index_position(enc_index_position),
+        .pid2_select(pid2_select),
+        .pid2_clear(pid2_clear),
+        .pid2_d_alpha(pid2_d_alpha),
+        .pid2_kp(pid2_kp),
+        .pid2_ki(pid2_ki),
+        .pid2_kd(pid2_kd),
+        .pid2_kt(pid2_kt),
+        .pid2_weight_p(pid2_weight_p),
+        .pid2_weight_d(pid2_weight_d),
+        .pid2_integ(pid2_integ),
+        .cc_enable(cc_enable),
+        .cc_clear(cc_clear),
+        .cc_vel_shift(cc_vel_shift),
+        .cc_gain(cc_gain),
+        .cc_limit(cc_limit),
+        .cc_min_speed(cc_min_speed),
+        .cc_err(cc_err),
+        .cc_peak(cc_peak),
+        .cc_status(cc_status),
 
         // AXI connections
         .S_AXI_ACLK(s00_axi_aclk),
@@ -0,0 +1,265 @@
+`timescale 1ns / 1ps
+
+// 축별 biquad 캐스케이드 (notch / low-pass), 공유 파이프라인 MAC 1개로 모든 단을 순차 처리
+//
+// 체인 0 : 제어 출력 (pi_velocity_controller control_signal → PWM), 출력 ±CTRL_LIMIT 포화
+// 체인 1 : 피드백 (엔코더 위치 → 제어기 actual_pos). 틱마다 갱신되므로 제어기에는 1틱 지연
+//
+// 단마다 Direct Form I:  y = b0*x + b1*x1 + b2*x2 - a1*y1 - a2*y2
+// 계수는 Q4.28 (부호 32비트), 누산 68비트, 단 출력은 반올림 후 32비트 포화 (sticky 플래그).
+// 한 단은 곱 5회 + 파이프라인 3사이클, 2체인 x 4단 전체가 약 80사이클 (틱 주기 5000사이클).
+//
+// 계수는 AXI 에서 shadow 뱅크에 써 두고 commit 펄스를 주면 다음 틱 시작 전 유휴 구간에서
+// 활성 뱅크와 단별 enable 마스크가 한 번에 교체된다 (틱 도중 계수가 섞이지 않음).
+// enable 이 0 인 단은 bypass (y = x), 상태는 입력을 따라가도록 갱신해 재활성화 시 충격을 줄인다.
+
+module biquad_cascade #(
+    parameter integer NUM_STAGES = 4,
+    parameter integer COEF_FRAC = 28,
+    parameter signed [31:0] CTRL_LIMIT = 32'sd4000
+)(
+    input wire clk,                         // 100 MHz 시스템 클럭
+    input wire reset_n,                     // 리셋 신호 (Active Low)
+    input wire start,                       // 제어 틱 (control_signal 갱신 직후)
+    input wire signed [15:0] ctrl_in,       // 체인 0 입력
+    input wire signed [31:0] fb_in,         // 체인 1 입력
+
+    output reg signed [15:0] ctrl_out,      // 필터된 제어 신호
+    output reg signed [31:0] fb_out,        // 필터된 위치
+    output reg done,                        // 두 체인 출력 갱신 완료 펄스
+
+    // 계수 로드 (AXI)
+    input wire coef_we,
+    input wire [8:0] coef_sel,              // [3:0] 계수 (b0,b1,b2,a1,a2), [7:4] 단, [8] 체인
+    input wire [8:0] coef_rsel,             // 읽기 위치 (현재 BQ_SEL, 형식은 coef_sel 과 같음)
+    input wire signed [31:0] coef_wdata,
+    output wire signed [31:0] coef_rdata,   // coef_rsel 위치의 shadow 계수
+    input wire commit,                      // shadow → 활성 (다음 유휴 구간)
+    input wire commit_clear,                // commit 시 필터 상태 초기화 (피드백 체인은 현재 위치로)
+    input wire [15:0] enable_mask,          // [7:0] 체인 0 단 enable, [15:8] 체인 1 (commit 시 적용)
+    input wire [1:0] sat_clear,             // sticky 포화 플래그 클리어 (W1C)
+
+    output reg [15:0] active_mask,
+    output reg commit_pending,
+    output reg [1:0] sat_flags              // [0] 체인 0 포화, [1] 체인 1 포화
+);
+
+    localparam integer NUM_CHAINS = 2;
+    localparam integer NUM_SLOTS = NUM_CHAINS * NUM_STAGES;
+    localparam integer NUM_COEFS = NUM_SLOTS * 5;
+
+    localparam [2:0] S_IDLE = 3'd0,
+                     S_LOAD = 3'd1,
+                     S_MAC  = 3'd2,
+                     S_WAIT = 3'd3,
+                     S_WB   = 3'd4;
+
+    reg signed [31:0] coef_shadow [0:NUM_COEFS-1];
+    reg signed [31:0] coef_act [0:NUM_COEFS-1];
+    reg signed [31:0] st_x1 [0:NUM_SLOTS-1];
+    reg signed [31:0] st_x2 [0:NUM_SLOTS-1];
+    reg signed [31:0] st_y1 [0:NUM_SLOTS-1];
+    reg signed [31:0] st_y2 [0:NUM_SLOTS-1];
+
+    reg [2:0] state;
+    reg chain;
+    reg [3:0] stage;
+    reg [2:0] term;
+    reg [1:0] drain;
+    reg clear_pending;
+    reg signed [31:0] cur_x;                // 현재 단 입력
+
+    // 공유 MAC 파이프라인: 피연산자 → 곱 → 누산
+    reg signed [31:0] op_c, op_d;
+    reg op_valid;
+    reg signed [63:0] prod;
+    reg prod_valid;
+    reg signed [67:0] acc;
+
+    integer k;
+
+    wire [4:0] slot = chain * NUM_STAGES + stage;
+    wire [8:0] coef_base = chain * (NUM_STAGES * 5) + stage * 5;
+    wire [8:0] sel_index = coef_sel[8] * (NUM_STAGES * 5) + coef_sel[7:4] * 5 + coef_sel[3:0];
+    wire [8:0] rsel_index = coef_rsel[8] * (NUM_STAGES * 5) + coef_rsel[7:4] * 5 + coef_rsel[3:0];
+    wire stage_en = active_mask[{chain, 3'b000} + stage];
+
+    assign coef_rdata = (coef_rsel[3:0] < 5 && coef_rsel[7:4] < NUM_STAGES) ? coef_shadow[rsel_index] : 32'sd0;
+
+    // 반올림 + 32비트 포화
+    wire signed [67:0] acc_round = acc + (68'sd1 <<< (COEF_FRAC - 1));
+    wire signed [67:0] acc_shift = acc_round >>> COEF_FRAC;
+    wire acc_ovf = (acc_shift > 68'sd2147483647) || (acc_shift < -68'sd2147483647);
+    wire signed [31:0] y_sat = (acc_shift > 68'sd2147483647) ? 32'sd2147483647 :
+                               (acc_shift < -68'sd2147483647) ? -32'sd2147483647 : acc_shift[31:0];
+
+    // shadow 뱅크 쓰기 (리셋 없음, 초기값 0)
+    initial begin
+        for (k = 0; k < NUM_COEFS; k = k + 1)
+            coef_shadow[k] = 32'sd0;
+    end
+
+    always @(posedge clk) begin
+        if (coef_we && coef_sel[3:0] < 5 && coef_sel[7:4] < NUM_STAGES)
+            coef_shadow[sel_index] <= coef_wdata;
+    end
+
+    // 단 번호 → MAC 피연산자 (x, x1, x2, -y1, -y2)
+    always @(*) begin
+        case (term)
+            3'd0: op_d = cur_x;
+            3'd1: op_d = st_x1[slot];
+            3'd2: op_d = st_x2[slot];
+            3'd3: op_d = -st_y1[slot];
+            default: op_d = -st_y2[slot];
+        endcase
+        op_c = coef_act[coef_base + term];
+    end
+
+    // MAC 파이프라인
+    reg signed [31:0] op_c_r, op_d_r;
+    always @(posedge clk or negedge reset_n) begin
+        if (!reset_n) begin
+            op_c_r <= 32'sd0;
+            op_d_r <= 32'sd0;
+            op_valid <= 1'b0;
+            prod <= 64'sd0;
+            prod_valid <= 1'b0;
+        end else begin
+            op_valid <= (state == S_MAC);
+            op_c_r <= op_c;
+            op_d_r <= op_d;
+            prod_valid <= op_valid;
+            prod <= op_c_r * op_d_r;
+        end
+    end
+
+    always @(posedge clk or negedge reset_n) begin
+        if (!reset_n) begin
+            state <= S_IDLE;
+            chain <= 1'b0;
+            stage <= 4'd0;
+            term <= 3'd0;
+            drain <= 2'd0;
+            cur_x <= 32'sd0;
+            acc <= 68'sd0;
+            done <= 1'b0;
+            ctrl_out <= 16'sd0;
+            fb_out <= 32'sd0;
+            active_mask <= 16'd0;
+            commit_pending <= 1'b0;
+            clear_pending <= 1'b0;
+            sat_flags <= 2'b00;
+            for (k = 0; k < NUM_SLOTS; k = k + 1) begin
+                st_x1[k] <= 32'sd0;
+                st_x2[k] <= 32'sd0;
+                st_y1[k] <= 32'sd0;
+                st_y2[k] <= 32'sd0;
+            end
+            for (k = 0; k < NUM_COEFS; k = k + 1)
+                coef_act[k] <= 32'sd0;
+        end else begin
+            done <= 1'b0;
+            sat_flags <= sat_flags & ~sat_clear;
+
+            if (commit) begin
+                commit_pending <= 1'b1;
+                clear_pending <= commit_clear;
+            end
+
+            if (prod_valid)
+                acc <= acc + prod;
+
+            case (state)
+                S_IDLE: begin
+                    if (start) begin
+                        chain <= 1'b0;
+                        stage <= 4'd0;
+                        cur_x <= ctrl_in;           // 부호 확장
+                        state <= S_LOAD;
+                    end else if (commit_pending && !commit) begin
+                        // 틱 사이 유휴 구간에서 한 번에 교체
+                        for (k = 0; k < NUM_COEFS; k = k + 1)
+                            coef_act[k] <= coef_shadow[k];
+                        active_mask <= enable_mask;
+                        if (clear_pending) begin
+                            // 제어 체인은 0, 피드백 체인은 현재 위치로 (DC 이득 1 가정, 위치 점프 방지)
+                            for (k = 0; k < NUM_SLOTS; k = k + 1) begin
+                                st_x1[k] <= (k < NUM_STAGES) ? 32'sd0 : fb_in;
+                                st_x2[k] <= (k < NUM_STAGES) ? 32'sd0 : fb_in;
+                                st_y1[k] <= (k < NUM_STAGES) ? 32'sd0 : fb_in;
+                                st_y2[k] <= (k < NUM_STAGES) ? 32'sd0 : fb_in;
+                            end
+                        end
+                        commit_pending <= 1'b0;
+                        clear_pending <= 1'b0;
+                    end
+                end
+
+                S_LOAD: begin
+                    acc <= 68'sd0;
+                    term <= 3'd0;
+                    state <= stage_en ? S_MAC : S_WB;
+                end
+
+                S_MAC: begin
+                    if (term == 3'd4) begin
+                        drain <= 2'd2;
+                        state <= S_WAIT;
+                    end
+                    term <= term + 1;
+                end
+
+                S_WAIT: begin
+                    // 마지막 곱이 누산될 때까지 대기
+                    if (drain == 2'd0 && !op_valid && !prod_valid)
+                        state <= S_WB;
+                    else if (drain != 2'd0)
+                        drain <= drain - 1;
+                end
+
+                S_WB: begin : writeback
+                    reg signed [31:0] y;
+                    y = stage_en ? y_sat : cur_x;
+                    if (stage_en && acc_ovf)
+                        sat_flags[chain] <= 1'b1;
+
+                    st_x2[slot] <= st_x1[slot];
+                    st_x1[slot] <= cur_x;
+                    st_y2[slot] <= st_y1[slot];
+                    st_y1[slot] <= y;
+
+                    if (stage == NUM_STAGES - 1) begin
+                        if (chain == 1'b0) begin
+                            // 제어 출력 포화 (PWM 범위)
+                            if (y > CTRL_LIMIT) begin
+                                ctrl_out <= CTRL_LIMIT[15:0];
+                                if (active_mask[7:0] != 8'd0) sat_flags[0] <= 1'b1;
+                            end else if (y < -CTRL_LIMIT) begin
+                                ctrl_out <= -CTRL_LIMIT[15:0];
+                                if (active_mask[7:0] != 8'd0) sat_flags[0] <= 1'b1;
+                            end else begin
+                                ctrl_out <= y[15:0];
+                            end
+                            chain <= 1'b1;
+                            stage <= 4'd0;
+                            cur_x <= fb_in;
+                            state <= S_LOAD;
+                        end else begin
+                            fb_out <= y;
+                            done <= 1'b1;
+                            state <= S_IDLE;
+                        end
+                    end else begin
+                        stage <= stage + 1;
+                        cur_x <= y;
+                        state <= S_LOAD;
+                    end
+                end
+
+                default: state <= S_IDLE;
+            endcase
+        end
+    end
+
+endmodule
@@ -0,0 +1,290 @@
+`timescale 1ns / 1ps
+
+// 2축 교차 결합 윤곽 제어 (cross-coupled contouring). 블록 디자인에서 두 maxon_top 사이에 둔다.
+//
+// 축별 PID 는 각자 추종 오차만 줄이므로 두 축의 지연이 다르면 경로에서 벗어난다 (윤곽 오차).
+// 제어 틱마다 목표 경로 접선 방향 t = (cos θ, sin θ) 와 법선 n = (-sin θ, cos θ) 로
+//   e   = (desired_x - actual_x, desired_y - actual_y)
+//   ε   = n · e = -e_x sin θ + e_y cos θ     (윤곽 오차, 접선 방향 오차는 축별 제어기 몫)
+//   C   = Kc * ε * n                       (C_x = -Kc ε sin θ, C_y = Kc ε cos θ, |C| <= limit)
+// 를 계산해 두 축 제어 신호에 더한다 (motor_top cc_correction).
+//
+// θ 는 목표 위치 변화량 (틱당) 을 1차 저역 통과한 속도 벡터 방향. 이동이 min_speed 미만이면
+// 마지막 방향을 유지하고, 한 번도 움직이지 않았으면 (dir_valid = 0) ε = 0.
+// 각도를 따로 구하지 않고 CORDIC vectoring 으로 속도 벡터를 x 축에 돌려 놓는 같은 회전을 e 에도 적용해
+// ε 를 얻고 (나눗셈 / 삼각함수 없음), 회전 방향 비트를 거꾸로 적용해 (0, Kc ε) 를 축 좌표로 되돌린다.
+// 느린 구간의 속도 벡터는 수십 LSB 라 시프트가 곧 0 이 되므로, vectoring 전에 방향 벡터만 공통 좌측 시프트로
+// 정규화한다 (회전 각도는 크기와 무관, 오차 벡터는 그대로).
+//
+// tick 은 축 0 의 tlm_tick (모든 축 틱 동기). 계산은 약 50클럭이라 보정은 다음 제어 틱부터 반영되고,
+// 같은 틱의 텔레메트리 프레임에는 그 보정을 만든 (직전 틱) ε 가 실린다.
+// 게인은 pid_2dof_controller 와 같은 24비트 가수 + 5비트 시프트 (제어 단위 / 카운트).
+// clear 는 다음 틱에 적용된다 (속도 필터 / 방향 / 최대값 초기화).
+
+module contour_coupler #(
+    parameter signed [15:0] CTRL_LIMIT = 16'sd4000
+)(
+    input wire clk,                             // 100 MHz 시스템 클럭
+    input wire reset_n,                         // 리셋 신호 (Active Low)
+    input wire tick,                            // 축 0 tlm_tick
+    input wire signed [31:0] desired_x,         // 축 0 tlm_desired
+    input wire signed [31:0] actual_x,          // 축 0 tlm_actual
+    input wire signed [31:0] desired_y,         // 축 1 tlm_desired
+    input wire signed [31:0] actual_y,          // 축 1 tlm_actual
+
+    // 설정 (축 0 AXI)
+    input wire enable,                          // 0 이면 보정 0 (ε 는 계속 계산)
+    input wire clear,                           // 상태 초기화 펄스
+    input wire [2:0] vel_shift,                 // 속도 필터 시정수 2^n 틱
+    input wire [28:0] gain,                     // Kc: [23:0] 가수, [28:24] 시프트
+    input wire [15:0] limit,                    // |C| 제한 (제어 단위, CTRL_LIMIT 이하로 적용)
+    input wire [15:0] min_speed,                // 방향 갱신 최소 |v_x| + |v_y| (Q8.8 카운트/틱)
+
+    output reg signed [15:0] corr_x,            // 축 0 보정 (cc_correction)
+    output reg signed [15:0] corr_y,            // 축 1 보정
+    output reg signed [31:0] contour_err,       // ε (Q24.8 카운트)
+    output reg [31:0] contour_peak,             // clear 이후 최대 |ε| (Q24.8)
+    output reg dir_valid,                       // 경로 방향 확보
+    output reg done                             // 갱신 완료 펄스
+);
+
+    localparam integer W = 50;                  // Q8 위치 (41비트) + CORDIC 이득 / 회전 여유
+    localparam integer ITER = 16;
+    localparam signed [17:0] INV_K = 18'sd39797; // 1 / CORDIC 이득 (Q0.16, 1 / 1.6467603)
+    localparam signed [W-1:0] ERR_MAX = 50'sh7FFFFFFF;
+
+    localparam [2:0] S_IDLE = 3'd0,
+                     S_DIR  = 3'd1,
+                     S_VEC  = 3'd2,
+                     S_EPS  = 3'd3,
+                     S_GAIN = 3'd4,
+                     S_ROT  = 3'd5,
+                     S_FIN  = 3'd6,
+                     S_NORM = 3'd7;
+
+    reg [2:0] state;
+    reg [3:0] iter;
+    reg clear_pending;
+    reg primed;                                 // des_*_prev 유효 (첫 틱 속도 킥 방지)
+    reg flip;                                   // 방향 벡터 x < 0 → 180도 미리 회전
+
+    reg signed [31:0] des_x_prev, des_y_prev;
+    reg signed [W-1:0] vf_x, vf_y;              // 필터된 목표 속도 (Q8 카운트/틱)
+    reg signed [W-1:0] dir_x, dir_y;            // 마지막 유효 방향
+    reg signed [W-1:0] ex, ey;                  // 추종 오차 (Q8)
+    reg signed [W-1:0] cx, cy;                  // vectoring 대상 (방향 벡터)
+    reg signed [W-1:0] a, b;                    // 같이 회전하는 오차 / 보정 벡터
+    reg [ITER-1:0] dirs;                        // 단계별 회전 방향 (1 = 시계 방향)
+    reg signed [W-1:0] eps;                     // ε (Q8)
+
+    // 속도 필터: vf += (Δdesired - vf) >>> vel_shift
+    wire signed [31:0] dx = desired_x - des_x_prev;
+    wire signed [31:0] dy = desired_y - des_y_prev;
+    wire signed [W-1:0] dx_q8 = {{(W-40){dx[31]}}, dx, 8'd0};
+    wire signed [W-1:0] dy_q8 = {{(W-40){dy[31]}}, dy, 8'd0};
+
+    wire signed [32:0] ex_raw = desired_x - actual_x;
+    wire signed [32:0] ey_raw = desired_y - actual_y;
+
+    // 방향 선택
+    wire [W-1:0] abs_vx = vf_x[W-1] ? -vf_x : vf_x;
+    wire [W-1:0] abs_vy = vf_y[W-1] ? -vf_y : vf_y;
+    wire [W:0] speed = abs_vx + abs_vy;
+    wire moving = (speed != 0) && (speed >= min_speed);
+    wire signed [W-1:0] sel_x = moving ? vf_x : dir_x;
+    wire signed [W-1:0] sel_y = moving ? vf_y : dir_y;
+    wire sel_flip = sel_x[W-1];
+
+    // 방향 벡터 정규화: 두 성분의 |값| < 2^(W-11) 이면 8비트, < 2^(W-4) 이면 1비트 시프트
+    // (결과 |값| < 2^(W-3) → CORDIC 이득 1.65 와 대각 방향 √2 를 곱해도 W 비트 안)
+    wire norm8 = (cx[W-1:W-11] == {11{cx[W-1]}}) && (cy[W-1:W-11] == {11{cy[W-1]}});
+    wire norm1 = (cx[W-1:W-4] == {4{cx[W-1]}}) && (cy[W-1:W-4] == {4{cy[W-1]}});
+
+    // ε = b / K (반올림)
+    wire signed [W+17:0] eps_prod = b * INV_K + 68'sd32768;
+    wire signed [W-1:0] eps_next = eps_prod >>> 16;
+
+    // Kc ε (Q8) → ±lim 제한
+    wire [15:0] lim = (limit > CTRL_LIMIT) ? CTRL_LIMIT : limit;
+    wire signed [W-1:0] lim_q8 = {{(W-24){1'b0}}, lim, 8'd0};
+    wire signed [W+24:0] c_prod = $signed({1'b0, gain[23:0]}) * eps;
+    wire signed [W+24:0] c_sh = c_prod >>> gain[28:24];
+    wire signed [W-1:0] c_q8 = (c_sh > lim_q8) ? lim_q8 :
+                               (c_sh < -lim_q8) ? -lim_q8 : c_sh[W-1:0];
+
+    // 역회전 결과 / K, Q8 → 제어 단위 (반올림), 미리 회전 복원
+    wire signed [W+17:0] px_prod = a * INV_K + 68'sd8388608;
+    wire signed [W+17:0] py_prod = b * INV_K + 68'sd8388608;
+    wire signed [W-1:0] px = flip ? -(px_prod >>> 24) : (px_prod >>> 24);
+    wire signed [W-1:0] py = flip ? -(py_prod >>> 24) : (py_prod >>> 24);
+    wire signed [W-1:0] lim_w = {{(W-16){1'b0}}, lim};
+    wire signed [15:0] px_sat = (px > lim_w) ? lim : (px < -lim_w) ? -lim : px[15:0];
+    wire signed [15:0] py_sat = (py > lim_w) ? lim : (py < -lim_w) ? -lim : py[15:0];
+
+    wire [W-1:0] abs_eps = eps[W-1] ? -eps : eps;
+
+    always @(posedge clk or negedge reset_n) begin
+        if (!reset_n) begin
+            state <= S_IDLE;
+            iter <= 4'd0;
+            clear_pending <= 1'b0;
+            primed <= 1'b0;
+            flip <= 1'b0;
+            des_x_prev <= 32'sd0;
+            des_y_prev <= 32'sd0;
+            vf_x <= 0;
+            vf_y <= 0;
+            dir_x <= 0;
+            dir_y <= 0;
+            ex <= 0;
+            ey <= 0;
+            cx <= 0;
+            cy <= 0;
+            a <= 0;
+            b <= 0;
+            dirs <= 0;
+            eps <= 0;
+            corr_x <= 16'sd0;
+            corr_y <= 16'sd0;
+            contour_err <= 32'sd0;
+            contour_peak <= 32'd0;
+            dir_valid <= 1'b0;
+            done <= 1'b0;
+        end else begin
+            done <= 1'b0;
+            if (clear)
+                clear_pending <= 1'b1;
+            if (!enable) begin
+                corr_x <= 16'sd0;
+                corr_y <= 16'sd0;
+            end
+
+            case (state)
+                S_IDLE: begin
+                    if (tick) begin
+                        des_x_prev <= desired_x;
+                        des_y_prev <= desired_y;
+                        ex <= {{(W-41){ex_raw[32]}}, ex_raw, 8'd0};
+                        ey <= {{(W-41){ey_raw[32]}}, ey_raw, 8'd0};
+                        if (clear_pending) begin
+                            clear_pending <= clear;
+                            primed <= 1'b0;
+                            vf_x <= 0;
+                            vf_y <= 0;
+                            dir_valid <= 1'b0;
+                            contour_peak <= 32'd0;
+                        end else begin
+                            primed <= 1'b1;
+                            if (primed) begin
+                                vf_x <= vf_x + ((dx_q8 - vf_x) >>> vel_shift);
+                                vf_y <= vf_y + ((dy_q8 - vf_y) >>> vel_shift);
+                            end
+                        end
+                        state <= S_DIR;
+                    end
+                end
+
+                S_DIR: begin
+                    if (moving) begin
+                        dir_x <= vf_x;
+                        dir_y <= vf_y;
+                        dir_valid <= 1'b1;
+                    end
+                    // x >= 0 반평면으로 옮겨 CORDIC 수렴 범위 (±99.9도) 안에 둔다
+                    flip <= sel_flip;
+                    cx <= sel_flip ? -sel_x : sel_x;
+                    cy <= sel_flip ? -sel_y : sel_y;
+                    a <= sel_flip ? -ex : ex;
+                    b <= sel_flip ? -ey : ey;
+                    iter <= 4'd0;
+                    if (moving || dir_valid)
+                        state <= S_NORM;
+                    else begin
+                        eps <= 0;
+                        contour_err <= 32'sd0;
+                        a <= 0;
+                        b <= 0;
+                        state <= S_FIN;
+                    end
+                end
+
+                // 방향 벡터 정규화 (iter 를 단계 수로 사용, 최대 5 x 8 + 6 x 1 비트 = 11단계)
+                S_NORM: begin
+                    if (norm8 && iter != 4'd15) begin
+                        cx <= cx <<< 8;
+                        cy <= cy <<< 8;
+                        iter <= iter + 1;
+                    end else if (norm1 && iter != 4'd15) begin
+                        cx <= cx <<< 1;
+                        cy <= cy <<< 1;
+                        iter <= iter + 1;
+                    end else begin
+                        iter <= 4'd0;
+                        state <= S_VEC;
+                    end
+                end
+
+                // 방향 벡터를 x 축으로 (y → 0), 오차 벡터도 같은 각도만큼 회전 → b = K ε
+                S_VEC: begin
+                    if (!cy[W-1]) begin
+                        cx <= cx + (cy >>> iter);
+                        cy <= cy - (cx >>> iter);
+                        a <= a + (b >>> iter);
+                        b <= b - (a >>> iter);
+                    end else begin
+                        cx <= cx - (cy >>> iter);
+                        cy <= cy + (cx >>> iter);
+                        a <= a - (b >>> iter);
+                        b <= b + (a >>> iter);
+                    end
+                    dirs[iter] <= !cy[W-1];
+                    iter <= iter + 1;
+                    if (iter == ITER - 1)
+                        state <= S_EPS;
+                end
+
+                S_EPS: begin
+                    eps <= eps_next;
+                    state <= S_GAIN;
+                end
+
+                // 경로 좌표 (0, Kc ε) 를 같은 단계의 반대 방향 회전으로 축 좌표에 되돌림
+                S_GAIN: begin
+                    a <= 0;
+                    b <= c_q8;
+                    contour_err <= (eps > ERR_MAX) ? ERR_MAX[31:0] :
+                                   (eps < -ERR_MAX) ? -ERR_MAX[31:0] : eps[31:0];
+                    if (abs_eps > contour_peak)
+                        contour_peak <= (abs_eps > ERR_MAX) ? ERR_MAX[31:0] : abs_eps[31:0];
+                    iter <= 4'd0;
+                    state <= S_ROT;
+                end
+
+                S_ROT: begin
+                    if (dirs[iter]) begin
+                        a <= a - (b >>> iter);
+                        b <= b + (a >>> iter);
+                    end else begin
+                        a <= a + (b >>> iter);
+                        b <= b - (a >>> iter);
+                    end
+                    iter <= iter + 1;
+                    if (iter == ITER - 1)
+                        state <= S_FIN;
+                end
+
+                S_FIN: begin
+                    if (enable) begin
+                        corr_x <= px_sat;
+                        corr_y <= py_sat;
+                    end
+                    done <= 1'b1;
+                    state <= S_IDLE;
+                end
+
+                default: state <= S_IDLE;
+            endcase
+        end
+    end
+
+endmodule
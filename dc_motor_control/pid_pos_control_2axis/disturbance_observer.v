@@ -0,0 +1,172 @@
+`timescale 1ns / 1ps
+
+// 외란 관측기 (DOB): 공칭 플랜트 모델로 부하 토크를 추정해 제어 출력에서 상쇄
+//
+// 모든 양은 제어 신호 단위 (PWM 카운트, ±4000) 와 엔코더 카운트 / 제어 틱 기준.
+//   플랜트      : J * dv + B * v = u + d           (v = 카운트/틱, dv = 틱당 속도 변화)
+//   추정        : d_hat = Q(J * dv + B * v - u)    (Q = 1차 저역 통과, 계수 alpha)
+//   보상        : control = u_pid - d_hat          (±limit 제한 후 ±CTRL_LIMIT 포화)
+//
+// 위치를 두 번 미분하지 않도록 Q 를 속도 형태로 풀어 쓴다 (K = alpha * J):
+//   x[k]     = x[k-1] + alpha * (K * v[k-1] + u[k] - B * v[k] - x[k-1])
+//   d_hat[k] = K * v[k] - x[k]
+// 속도는 2^vel_shift 틱 창의 위치 차 (Q(vel_shift) 카운트/틱) 로 양자화 잡음을 줄인다.
+// u 는 지난 틱 동안 실제로 PWM 에 인가된 값 (필터/포화 후) 이므로 포화 중에도 추정이 맞다.
+//
+// 추정은 enable 과 무관하게 항상 돌고 (텔레메트리), enable 은 보상 적용만 결정한다.
+// 제어 틱마다 4사이클 (속도 → 곱 → 차 → Q 갱신) 후 done 펄스. clear 는 다음 틱에 적용된다.
+// hold 동안 (안전 트립, 출력 차단) 에는 d_hat 을 마지막 값으로 유지하고 x 를 그에 맞춰 다시 맞춘다.
+
+module disturbance_observer #(
+    parameter signed [31:0] CTRL_LIMIT = 32'sd4000
+)(
+    input wire clk,                         // 100 MHz 시스템 클럭
+    input wire reset_n,                     // 리셋 신호 (Active Low)
+    input wire start,                       // 제어 틱 (control_signal 갱신 직후)
+    input wire signed [31:0] position,      // 엔코더 위치
+    input wire signed [15:0] u_applied,     // 지난 틱 PWM 입력 (보상/필터 후)
+    input wire signed [15:0] ctrl_in,       // 제어기 출력
+
+    output reg signed [15:0] ctrl_out,      // 보상된 제어 신호
+    output reg signed [31:0] d_est,         // 추정 외란 (제어 신호 단위, 제한 전)
+    output reg done,                        // 출력 갱신 완료 펄스
+
+    // 설정 (AXI)
+    input wire enable,                      // 1: 보상 적용
+    input wire clear,                       // 추정 상태 초기화 (d_hat = 0) 펄스
+    input wire hold,                        // 1 인 동안 추정 유지 (u 가 실제로 인가되지 않는 구간)
+    input wire [2:0] vel_shift,             // 속도 창 2^n 틱 (0 ~ 4)
+    input wire [15:0] alpha,                // Q-filter 계수 Q0.16 = 1 - exp(-2*pi*fc/fs)
+    input wire [31:0] k_j,                  // alpha * J  (Q16.16, 단위 / (카운트/틱))
+    input wire [31:0] b_n,                  // B          (Q16.16, 단위 / (카운트/틱))
+    input wire [15:0] limit                 // |보상| 제한 (제어 신호 단위)
+);
+
+    localparam integer HIST = 16;
+
+    localparam [2:0] S_IDLE = 3'd0,
+                     S_MUL  = 3'd1,
+                     S_DIFF = 3'd2,
+                     S_ACC  = 3'd3,
+                     S_OUT  = 3'd4;
+
+    reg [2:0] state;
+    reg clear_pending;
+    reg signed [31:0] pos_hist [0:HIST-1];  // [0] = 지난 틱 위치
+    reg signed [31:0] vel, vel_prev;        // Q(vel_shift) 카운트/틱
+    reg signed [15:0] u_r, ctrl_r;
+    reg [2:0] shift_r;
+
+    reg signed [63:0] x;                    // Q16 (제어 신호 단위)
+    reg signed [64:0] p_k, p_kprev, p_b;
+    reg signed [63:0] diff;
+    reg signed [80:0] p_alpha;
+
+    integer i;
+
+    wire [2:0] shift_c = (vel_shift > 3'd4) ? 3'd4 : vel_shift;
+    wire signed [32:0] k_s = $signed({1'b0, k_j});
+    wire signed [32:0] b_s = $signed({1'b0, b_n});
+    wire signed [16:0] alpha_s = $signed({1'b0, alpha});
+
+    wire signed [63:0] term_k = p_k >>> shift_r;
+    wire signed [63:0] term_kprev = p_kprev >>> shift_r;
+    wire signed [63:0] term_b = p_b >>> shift_r;
+    wire signed [63:0] x_next = x + (p_alpha >>> 16);
+    wire signed [63:0] d_q16 = term_k - x_next + 64'sd32768;   // 반올림
+    wire signed [47:0] d_hat = d_q16 >>> 16;
+
+    wire signed [31:0] d_sat = (d_hat > 48'sd2147483647) ? 32'sd2147483647 :
+                               (d_hat < -48'sd2147483647) ? -32'sd2147483647 : d_hat[31:0];
+    wire signed [31:0] d_use = hold ? d_est : d_sat;
+    wire signed [63:0] x_hold = term_k - ({{32{d_est[31]}}, d_est} <<< 16);   // 다음 틱 d_hat = d_est
+
+    wire signed [31:0] limit_s = {16'd0, limit};
+    wire signed [31:0] comp = (d_use > limit_s) ? limit_s :
+                              (d_use < -limit_s) ? -limit_s : d_use;
+    wire signed [31:0] u_comp = ctrl_r - (enable ? comp : 32'sd0);
+
+    always @(posedge clk or negedge reset_n) begin
+        if (!reset_n) begin
+            state <= S_IDLE;
+            clear_pending <= 1'b0;
+            for (i = 0; i < HIST; i = i + 1)
+                pos_hist[i] <= 32'sd0;
+            vel <= 32'sd0;
+            vel_prev <= 32'sd0;
+            u_r <= 16'sd0;
+            ctrl_r <= 16'sd0;
+            shift_r <= 3'd0;
+            x <= 64'sd0;
+            p_k <= 65'sd0;
+            p_kprev <= 65'sd0;
+            p_b <= 65'sd0;
+            diff <= 64'sd0;
+            p_alpha <= 81'sd0;
+            ctrl_out <= 16'sd0;
+            d_est <= 32'sd0;
+            done <= 1'b0;
+        end else begin
+            done <= 1'b0;
+            if (clear)
+                clear_pending <= 1'b1;
+
+            case (state)
+                S_IDLE: begin
+                    if (start) begin
+                        // 창 길이만큼 이전 위치와의 차 → Q(shift) 속도
+                        vel <= position - pos_hist[(1 << shift_c) - 1];
+                        vel_prev <= vel;
+                        for (i = HIST - 1; i > 0; i = i - 1)
+                            pos_hist[i] <= pos_hist[i - 1];
+                        pos_hist[0] <= position;
+                        u_r <= u_applied;
+                        ctrl_r <= ctrl_in;
+                        shift_r <= shift_c;
+                        state <= S_MUL;
+                    end
+                end
+
+                S_MUL: begin
+                    p_k <= k_s * vel;
+                    p_kprev <= k_s * vel_prev;
+                    p_b <= b_s * vel;
+                    state <= S_DIFF;
+                end
+
+                S_DIFF: begin
+                    diff <= term_kprev + ($signed({{48{u_r[15]}}, u_r}) <<< 16) - term_b - x;
+                    state <= S_ACC;
+                end
+
+                S_ACC: begin
+                    p_alpha <= alpha_s * diff;
+                    state <= S_OUT;
+                end
+
+                S_OUT: begin
+                    if (clear_pending) begin
+                        clear_pending <= clear;
+                        x <= term_k;
+                        d_est <= 32'sd0;
+                        ctrl_out <= ctrl_r;
+                    end else begin
+                        x <= hold ? x_hold : x_next;
+                        d_est <= d_use;
+                        if (u_comp > CTRL_LIMIT)
+                            ctrl_out <= CTRL_LIMIT[15:0];
+                        else if (u_comp < -CTRL_LIMIT)
+                            ctrl_out <= -CTRL_LIMIT[15:0];
+                        else
+                            ctrl_out <= u_comp[15:0];
+                    end
+                    done <= 1'b1;
+                    state <= S_IDLE;
+                end
+
+                default: state <= S_IDLE;
+            endcase
+        end
+    end
+
+endmodule
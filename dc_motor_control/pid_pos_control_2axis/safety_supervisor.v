@@ -0,0 +1,145 @@
+`timescale 1ns / 1ps
+
+// 축별 안전 감시기: PS 소프트웨어와 무관하게 클럭 단위로 이상을 감지해 모터 출력을 차단
+//
+// 트립 원인 (fault 비트, enable_mask 로 개별 활성화):
+//   [0] 추종 오차   : |desired - position| > follow_limit        (매 클럭)
+//   [1] 과속        : 마지막 제어 틱 이후 이동량 > speed_limit      (매 클럭, 틱 경계에서 기준 갱신)
+//   [2] 포화 지속   : |control| >= CTRL_LIMIT 인 틱이 sat_ticks 번 연속
+//   [3] 엔코더 오류 : quadrature_encoder error_flag
+//   [4] 워치독      : wd_timeout 클럭 동안 kick 없음 (timeout 0 = 끔)
+//   [5] 소프트웨어  : force_trip 펄스 (mask 와 무관)
+// 조건은 입력 레지스터 → 비교 → 트립 래치 → 출력 레지스터 순으로 3클럭 안에 출력에 반영된다.
+//
+// 트립 시 PWM 생성기 뒤에서 출력 핀을 강제한다 (제어기 / PWM 상태와 무관).
+//   brake = 0 : 코스트 (dir1 = dir2 = 0, pwm = 0)
+//   brake = 1 : 단락 제동 (dir1 = dir2 = 1, pwm = 1)
+// 트립 순간의 원인 비트와 PL 타임스탬프를 래치하며 (다음 트립까지 유지), AXI clear 펄스로만 해제된다
+// (clear 시점에 원인이 남아 있으면 다음 클럭에 다시 트립). 해제 전에 PS 가 목표 위치를
+// 현재 위치로 맞춰야 추종 오차 트립이 반복되지 않는다.
+
+module safety_supervisor #(
+    parameter signed [31:0] CTRL_LIMIT = 32'sd4000
+)(
+    input wire clk,                         // 100 MHz 시스템 클럭
+    input wire reset_n,                     // 리셋 신호 (Active Low)
+    input wire tick,                        // 제어 틱 (PWM 입력 갱신 완료)
+    input wire signed [31:0] desired,       // 목표 위치
+    input wire signed [31:0] position,      // 엔코더 위치
+    input wire signed [15:0] control,       // PWM 입력
+    input wire encoder_fault,               // 엔코더 error_flag
+    input wire [63:0] ts_now,               // PL 타임스탬프
+
+    // 설정 (AXI)
+    input wire [4:0] enable_mask,           // 원인별 enable ([5] 는 항상 활성)
+    input wire brake,                       // 트립 시 1: 제동, 0: 코스트
+    input wire [31:0] follow_limit,         // 카운트
+    input wire [15:0] speed_limit,          // 카운트 / 제어 틱
+    input wire [15:0] sat_ticks,            // 연속 포화 틱 수
+    input wire [30:0] wd_timeout,           // 클럭 (10 ns), 0 = 끔
+    input wire wd_kick,                     // 워치독 재장전 펄스
+    input wire force_trip,                  // 소프트웨어 트립 펄스
+    input wire clear,                       // 트립 해제 펄스
+
+    // 모터 출력 게이트
+    input wire dir1_in,
+    input wire dir2_in,
+    input wire pwm_in,
+    output reg dir1_out,
+    output reg dir2_out,
+    output reg pwm_out,
+
+    output reg tripped,
+    output reg [5:0] fault_latched,         // 마지막 트립 순간의 원인
+    output wire [5:0] fault_live,           // 현재 원인 (mask 적용 전)
+    output reg [63:0] trip_ts
+);
+
+    reg signed [31:0] desired_r, position_r, tick_position;
+    reg encoder_fault_r;
+    reg [15:0] sat_count;
+    reg [30:0] wd_count;
+    reg wd_expired;
+
+    wire signed [31:0] follow_err = desired_r - position_r;
+    wire signed [31:0] move = position_r - tick_position;
+    wire [31:0] follow_abs = follow_err[31] ? -follow_err : follow_err;
+    wire [31:0] move_abs = move[31] ? -move : move;
+    wire sat_now = (control >= CTRL_LIMIT) || (control <= -CTRL_LIMIT);     // 틱과 같은 클럭에 갱신됨
+
+    assign fault_live = {force_trip,
+                         wd_expired,
+                         encoder_fault_r,
+                         (sat_ticks != 16'd0) && (sat_count >= sat_ticks),
+                         move_abs > {16'd0, speed_limit},
+                         follow_abs > follow_limit};
+
+    wire [5:0] fault_active = fault_live & {1'b1, enable_mask};
+
+    // 입력 레지스터, 포화 카운트, 워치독
+    always @(posedge clk or negedge reset_n) begin
+        if (!reset_n) begin
+            desired_r <= 32'sd0;
+            position_r <= 32'sd0;
+            tick_position <= 32'sd0;
+            encoder_fault_r <= 1'b0;
+            sat_count <= 16'd0;
+            wd_count <= 31'd0;
+            wd_expired <= 1'b0;
+        end else begin
+            desired_r <= desired;
+            position_r <= position;
+            encoder_fault_r <= encoder_fault;
+
+            if (tick) begin
+                tick_position <= position_r;
+                if (!sat_now)
+                    sat_count <= 16'd0;
+                else if (sat_count != 16'hFFFF)
+                    sat_count <= sat_count + 1;
+            end
+
+            if (wd_kick || clear || wd_timeout == 31'd0) begin
+                wd_count <= wd_timeout;
+                wd_expired <= 1'b0;
+            end else if (wd_count != 31'd0) begin
+                wd_count <= wd_count - 1;
+            end else begin
+                wd_expired <= 1'b1;
+            end
+        end
+    end
+
+    // 트립 래치
+    always @(posedge clk or negedge reset_n) begin
+        if (!reset_n) begin
+            tripped <= 1'b0;
+            fault_latched <= 6'd0;
+            trip_ts <= 64'd0;
+        end else if (clear) begin
+            tripped <= 1'b0;
+        end else if (!tripped && fault_active != 6'd0) begin
+            tripped <= 1'b1;
+            fault_latched <= fault_active;
+            trip_ts <= ts_now;
+        end
+    end
+
+    // 출력 게이트
+    always @(posedge clk or negedge reset_n) begin
+        if (!reset_n) begin
+            dir1_out <= 1'b0;
+            dir2_out <= 1'b0;
+            pwm_out <= 1'b0;
+        end else if (tripped) begin
+            dir1_out <= brake;
+            dir2_out <= brake;
+            pwm_out <= brake;
+        end else begin
+            dir1_out <= dir1_in;
+            dir2_out <= dir2_in;
+            pwm_out <= pwm_in;
+        end
+    end
+
+endmodule
@@ -0,0 +1,54 @@
+`timescale 1ns / 1ps
+
+// 64비트 PL 타임스탬프 + 제어 틱 상태 스냅샷
+// 모든 값은 같은 제어 틱(tick)에서 한 번에 래치된다. 두 축은 같은 클럭/리셋을 쓰므로
+// 타임스탬프도 축 간에 일치한다. AXI 에서는 SNAP_TS_LO 읽기 시 한 번 더 고정된다.
+
+module status_snapshot (
+    input wire clk,                         // 100 MHz 시스템 클럭
+    input wire reset_n,                     // 리셋 신호 (Active Low)
+    input wire tick,                        // 제어 주기 갱신 완료 펄스
+    input wire signed [31:0] desired,       // 이번 틱 목표 위치
+    input wire signed [31:0] actual,        // 이번 틱 실제 위치
+    input wire signed [31:0] error,         // 이번 틱 오차
+    input wire signed [15:0] control,       // 제어 신호
+    input wire [31:0] flags,                // 상태 플래그
+
+    output reg [63:0] ts_now,               // free-running 타임스탬프 (10 ns 단위)
+    output reg [63:0] snap_ts,
+    output reg [31:0] snap_tick,
+    output reg signed [31:0] snap_desired,
+    output reg signed [31:0] snap_actual,
+    output reg signed [31:0] snap_error,
+    output reg signed [31:0] snap_control,  // 부호 확장
+    output reg [31:0] snap_flags
+);
+
+    always @(posedge clk or negedge reset_n) begin
+        if (!reset_n)
+            ts_now <= 64'd0;
+        else
+            ts_now <= ts_now + 1;
+    end
+
+    always @(posedge clk or negedge reset_n) begin
+        if (!reset_n) begin
+            snap_ts <= 64'd0;
+            snap_tick <= 32'd0;
+            snap_desired <= 32'sd0;
+            snap_actual <= 32'sd0;
+            snap_error <= 32'sd0;
+            snap_control <= 32'sd0;
+            snap_flags <= 32'd0;
+        end else if (tick) begin
+            snap_ts <= ts_now;
+            snap_tick <= snap_tick + 1;
+            snap_desired <= desired;
+            snap_actual <= actual;
+            snap_error <= error;
+            snap_control <= control;        // 부호 확장 대입
+            snap_flags <= flags;
+        end
+    end
+
+endmodule
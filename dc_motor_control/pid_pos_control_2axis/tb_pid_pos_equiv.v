@@ -0,0 +1,109 @@
+`timescale 1ns / 1ps
+
+// pi_velocity_controller RTL ↔ 골든 모델 (tools/pid_golden.hpp) 등가성 시험
+//
+// 벡터는 tools/pid_golden vectors 로 만든다 (한 줄 = 한 제어 틱, 16진수):
+//   rst kp ki kd desired actual expected_control expected_error
+// rst = 1 이면 그 틱 전에 reset_n 을 내린다. 입력은 틱 사이 (ctrl_tick 직후) 에 바꾸고,
+// 다음 ctrl_tick 에서 control_signal / tlm_error 를 기대값과 비교한다.
+// DIVIDER 를 줄여 틱 간격만 짧게 하며 (레지스터 동작은 같음), 불일치는 처음 MAX_REPORT 개만 출력한다.
+//
+//   pid_golden vectors -o pid_vectors.hex            (Pid_pos_fuzzy.v 는 --fuzzy)
+//   iverilog -o tb tb_pid_pos_equiv.v Pid_pos.v && vvp tb +vec=pid_vectors.hex
+
+module tb_pid_pos_equiv;
+
+    parameter DIVIDER = 8;
+    parameter MAX_REPORT = 20;
+
+    reg clk = 1'b0;
+    reg reset_n = 1'b0;
+    reg [15:0] kp, ki, kd;
+    reg signed [31:0] desired, actual;
+
+    wire signed [15:0] control;
+    wire ctrl_tick;
+    wire signed [31:0] tlm_desired, tlm_actual, tlm_error;
+
+    always #5 clk = ~clk;
+
+    pi_velocity_controller #(
+        .DIVIDER(DIVIDER)
+    ) dut (
+        .clk(clk),
+        .reset_n(reset_n),
+        .desired_pos(desired),
+        .actual_pos(actual),
+        .Kp_axi(kp),
+        .Ki_axi(ki),
+        .Kd_axi(kd),
+        .control_signal(control),
+        .integ_clear(1'b0),
+        .ctrl_tick(ctrl_tick),
+        .tlm_desired(tlm_desired),
+        .tlm_actual(tlm_actual),
+        .tlm_error(tlm_error)
+    );
+
+    reg [1023:0] path;
+    integer fd, n, ticks, errors;
+    reg [31:0] v_rst, v_kp, v_ki, v_kd, v_des, v_act, v_ctl, v_err;
+
+    initial begin
+        if (!$value$plusargs("vec=%s", path))
+            path = "pid_vectors.hex";
+        fd = $fopen(path, "r");
+        if (fd == 0) begin
+            $display("[ERR] cannot open %0s", path);
+            $finish;
+        end
+
+        ticks = 0;
+        errors = 0;
+        kp = 16'd0; ki = 16'd0; kd = 16'd0;
+        desired = 32'sd0; actual = 32'sd0;
+
+        n = $fscanf(fd, "%h %h %h %h %h %h %h %h\n", v_rst, v_kp, v_ki, v_kd, v_des, v_act, v_ctl, v_err);
+        while (n == 8) begin
+            kp = v_kp[15:0];
+            ki = v_ki[15:0];
+            kd = v_kd[15:0];
+            desired = v_des;
+            actual = v_act;
+
+            if (v_rst[0]) begin
+                // 리셋 해제 직후 첫 클럭이 clk_20k_enable
+                reset_n = 1'b0;
+                repeat (2) @(posedge clk);
+                #1 reset_n = 1'b1;
+            end
+
+            @(posedge clk);
+            #1;
+            while (!ctrl_tick) begin
+                @(posedge clk);
+                #1;
+            end
+
+            if (control !== v_ctl[15:0] || tlm_error !== v_err) begin
+                if (errors < MAX_REPORT)
+                    $display("[ERR] tick %0d: control %0d (expected %0d), error %0d (expected %0d)",
+                             ticks, control, $signed(v_ctl[15:0]), tlm_error, $signed(v_err));
+                errors = errors + 1;
+            end
+            ticks = ticks + 1;
+
+            n = $fscanf(fd, "%h %h %h %h %h %h %h %h\n", v_rst, v_kp, v_ki, v_kd, v_des, v_act, v_ctl, v_err);
+        end
+
+        $fclose(fd);
+        if (ticks == 0)
+            $display("[ERR] no vectors in %0s", path);
+        else if (errors == 0)
+            $display("[OK] %0d ticks match", ticks);
+        else
+            $display("[FAIL] %0d of %0d ticks differ", errors, ticks);
+        $finish;
+    end
+
+endmodule
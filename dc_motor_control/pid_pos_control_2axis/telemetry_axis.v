@@ -0,0 +1,116 @@
+`timescale 1ns / 1ps
+
+// 다축 텔레메트리 AXI-Stream 소스 (AXI DMA S2MM → HP0 → DDR 링 버퍼)
+//
+// 제어 틱마다 프레임 1개를 캡처한다.
+//   word 0            : 프레임 카운터 (드롭 포함 연속 증가, PS 에서 누락 검출)
+//   word 1 + 5*i + 0  : axis i desired
+//   word 1 + 5*i + 1  : axis i actual
+//   word 1 + 5*i + 2  : axis i error
+//   word 1 + 5*i + 3  : axis i control_signal (부호 확장)
+//   word 1 + 5*i + 4  : axis i 추정 외란 (disturbance_observer)
+//   word 1 + 5*N      : 윤곽 오차 (contour_coupler, Q24.8, 이 프레임 control 에 들어간 보정의 ε)
+// 한 프레임의 desired / actual / error 는 같은 제어 틱 값이다. control 은 제어기 파이프라인만큼 늦은 입력으로
+// 계산된 값이다 (pi_velocity_controller 5틱 전 desired / actual, pid_2dof_controller 같은 틱).
+// FRAMES_PER_PACKET 프레임마다 tlast → DMA 버퍼 1개.
+// 다음 틱까지 프레임을 다 내보내지 못하면 (DMA 미준비) 해당 프레임은 버리고 drop_count 증가.
+// enable / drop_count 는 AXI GPIO 로 연결한다.
+
+module telemetry_axis #(
+    parameter integer NUM_AXES = 2,
+    parameter integer FRAMES_PER_PACKET = 64
+)(
+    input wire clk,                                 // 100 MHz (제어 클럭과 동일)
+    input wire reset_n,                             // 리셋 신호 (Active Low)
+    input wire enable,                              // 1: 스트리밍 (패킷 경계에서 시작/정지)
+
+    // 축별 텔레메트리 (maxon_top tlm_* 포트, 모든 축 틱 동기)
+    input wire [NUM_AXES-1:0] tlm_tick,
+    input wire [NUM_AXES*32-1:0] tlm_desired,
+    input wire [NUM_AXES*32-1:0] tlm_actual,
+    input wire [NUM_AXES*32-1:0] tlm_error,
+    input wire [NUM_AXES*16-1:0] tlm_control,
+    input wire [NUM_AXES*32-1:0] tlm_disturbance,
+    input wire [31:0] tlm_contour,                  // contour_coupler contour_err
+
+    // AXI-Stream master
+    output wire [31:0] m_axis_tdata,
+    output wire m_axis_tvalid,
+    input wire m_axis_tready,
+    output wire m_axis_tlast,
+
+    output reg [31:0] drop_count                    // 버린 프레임 수
+);
+
+    localparam integer FRAME_WORDS = 2 + 5 * NUM_AXES;
+
+    reg [31:0] frame [0:FRAME_WORDS-1];             // 캡처된 프레임
+    reg [31:0] frame_count;
+    reg [7:0] word_idx;
+    reg [15:0] pkt_frame_idx;                       // 패킷 내 프레임 번호
+    reg sending;
+    reg running;
+
+    integer i;
+
+    wire tick = tlm_tick[0];
+    wire last_word = (word_idx == FRAME_WORDS - 1);
+    wire last_frame = (pkt_frame_idx == FRAMES_PER_PACKET - 1);
+
+    assign m_axis_tdata  = frame[word_idx];
+    assign m_axis_tvalid = sending;
+    assign m_axis_tlast  = sending && last_word && last_frame;
+
+    always @(posedge clk or negedge reset_n) begin
+        if (!reset_n) begin
+            frame_count <= 32'd0;
+            word_idx <= 8'd0;
+            pkt_frame_idx <= 16'd0;
+            sending <= 1'b0;
+            running <= 1'b0;
+            drop_count <= 32'd0;
+            for (i = 0; i < FRAME_WORDS; i = i + 1)
+                frame[i] <= 32'd0;
+        end else begin
+            // 프레임 전송
+            if (sending && m_axis_tready) begin
+                if (last_word) begin
+                    sending <= 1'b0;
+                    word_idx <= 8'd0;
+                    if (last_frame) begin
+                        pkt_frame_idx <= 16'd0;
+                        if (!enable) running <= 1'b0;   // 패킷 경계에서만 정지
+                    end else begin
+                        pkt_frame_idx <= pkt_frame_idx + 1;
+                    end
+                end else begin
+                    word_idx <= word_idx + 1;
+                end
+            end
+
+            // 틱마다 캡처
+            if (tick) begin
+                frame_count <= frame_count + 1;
+                // 정지 상태에서는 pkt_frame_idx 가 항상 0 이므로 패킷 경계에서 시작
+                if ((running || enable) && !sending) begin
+                    running <= 1'b1;
+                    frame[0] <= frame_count;
+                    for (i = 0; i < NUM_AXES; i = i + 1) begin
+                        frame[1 + 5*i + 0] <= tlm_desired[i*32 +: 32];
+                        frame[1 + 5*i + 1] <= tlm_actual[i*32 +: 32];
+                        frame[1 + 5*i + 2] <= tlm_error[i*32 +: 32];
+                        frame[1 + 5*i + 3] <= {{16{tlm_control[i*16 + 15]}}, tlm_control[i*16 +: 16]};
+                        frame[1 + 5*i + 4] <= tlm_disturbance[i*32 +: 32];
+                    end
+                    frame[1 + 5*NUM_AXES] <= tlm_contour;
+                    sending <= 1'b1;
+                    word_idx <= 8'd0;
+                end else if (running && sending) begin
+                    // 이전 프레임이 아직 전송 중 (DMA 버퍼 미준비)
+                    drop_count <= drop_count + 1;
+                end
+            end
+        end
+    end
+
+endmodule
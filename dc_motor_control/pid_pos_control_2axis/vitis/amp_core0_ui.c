@@ -0,0 +1,263 @@
+// amp_core0_ui.c: CPU0 CLI / 트라젝토리 계획 / SD 로깅 (AMP 구성, amp_shared.h 참고)
+// scanf 로 블록하지 않도록 UART 를 폴링하며 한 줄씩 명령을 받고,
+// 그 사이 텔레메트리 링을 비워 SD 에 기록한다. SD 쓰기가 느려도 CPU1 제어 주기는 영향 없음.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <string.h>
+#include "xparameters.h"
+#include "xil_io.h"
+#include "xil_mmu.h"
+#include "xil_printf.h"
+#include "xuartps_hw.h"
+#include "ff.h"
+#include "xtime_l.h"
+#include "amp_shared.h"
+
+// 트라젝틱 주파수 (amp_core1_rt.c 와 동일해야 함)
+#define CMD_FREQ_HZ    5000
+#define LOG_BUF_SIZE   4096
+
+FATFS fs;
+FIL fil;
+bool log_enabled = true;
+bool log_header_written = false;
+char log_filename[12];  // "LOGxx.CSV"
+int log_file_counter = 1;
+
+float kp_f = 0.0f, ki_f = 0.0f, kd_f = 0.0f;
+int plan_slot = 0;
+
+char log_buf[LOG_BUF_SIZE];
+u32 log_len = 0;
+u32 tlm_expected_seq = 0;
+u32 tlm_lost = 0;
+u32 traj_done_seen = 0;
+u64 t_prev_us = 0;
+
+char line[64];
+int line_len = 0;
+
+int float_to_q78(float val) {
+    if (val < 0.0f) val = 0.0f;
+    if (val > 127.996f) val = 127.996f;
+    return ((int)(val * 256.0f)) & 0x7FFF;
+}
+
+static void send_cmd(u32 type, u32 axis_mask, s32 a0, s32 a1) {
+    amp_cmd_t cmd;
+    memset(&cmd, 0, sizeof(cmd));
+    cmd.type = type;
+    cmd.axis_mask = axis_mask;
+    cmd.arg[0] = a0;
+    cmd.arg[1] = a1;
+    if (!amp_ring_push(&AMP_SHM->cmd_ring, &cmd))
+        printf("[ERR] command ring full (overflow=%lu)\n", (unsigned long)AMP_SHM->cmd_ring.overflow);
+}
+
+static void start_cpu1(void) {
+    Xil_Out32(AMP_CPU1_START_REG, AMP_CPU1_START_ADDR);
+    AMP_DMB();
+    __asm__ __volatile__ ("sev");
+}
+
+static void log_flush(void) {
+    UINT bw;
+    if (log_len == 0) return;
+    if (log_enabled) f_write(&fil, log_buf, log_len, &bw);
+    log_len = 0;
+}
+
+static bool log_open_next(void) {
+    snprintf(log_filename, sizeof(log_filename), "LOG%02d.CSV", log_file_counter++);
+    FRESULT res = f_open(&fil, log_filename, FA_CREATE_ALWAYS | FA_WRITE);
+    if (res != FR_OK) {
+        printf("[ERR] f_open failed: %d\n", res);
+        return false;
+    }
+    log_header_written = false;
+    return true;
+}
+
+// 텔레메트리 링 비우기 → 4 KB 단위로 SD 기록
+// 완료는 LAST 샘플이 아니라 traj_done 으로 판정 (링이 넘쳐 LAST 가 버려져도 누락되지 않음)
+static void drain_telemetry(void) {
+    amp_tlm_t tlm;
+    u32 done = AMP_SHM->traj_done;
+    AMP_DMB();                          // 완료 확인 후 링 읽기 → 마지막 샘플까지 이번에 비움
+    while (amp_ring_pop(&AMP_SHM->tlm_ring, &tlm)) {
+        if (tlm.seq != tlm_expected_seq) tlm_lost += tlm.seq - tlm_expected_seq;
+        tlm_expected_seq = tlm.seq + 1;
+
+        if (log_enabled) {
+            if (!log_header_written) {
+                log_len += snprintf(log_buf + log_len, LOG_BUF_SIZE - log_len,
+                                    "Time_ms,Delta_ms,Kp,Ki,Kd,Des1,Act1,Err1,Des2,Act2,Err2\n");
+                log_header_written = true;
+            }
+            u64 del = tlm.t_us - t_prev_us;
+            log_len += snprintf(log_buf + log_len, LOG_BUF_SIZE - log_len,
+                                "%llu.%03lu,%llu.%03lu,%.3f,%.3f,%.3f,%ld,%ld,%ld,%ld,%ld,%ld\n",
+                                tlm.t_us / 1000, (unsigned long)(tlm.t_us % 1000),
+                                del / 1000, (unsigned long)(del % 1000),
+                                kp_f, ki_f, kd_f,
+                                (long)tlm.des[0], (long)tlm.act[0], (long)(tlm.des[0] - tlm.act[0]),
+                                (long)tlm.des[1], (long)tlm.act[1], (long)(tlm.des[1] - tlm.act[1]));
+            if (log_len > LOG_BUF_SIZE - 128) log_flush();
+        }
+        t_prev_us = tlm.t_us;
+    }
+
+    if (done != traj_done_seen) {
+        traj_done_seen = done;
+        log_flush();
+        if (log_enabled) f_sync(&fil);
+        printf("[OK] Trajectory done. (lost=%lu)\n", (unsigned long)tlm_lost);
+    }
+}
+
+static void print_menu(void) {
+    printf("\n======= 2-Axis Control Menu (AMP) =======\n");
+    printf("1 <Kp> <Ki> <Kd>  : Set PID Gains (0.0 ~ 127.996)\n");
+    printf("2 <pos1> <pos2>   : Quintic Trajectory Planning (Forward & Return)\n");
+    printf("3                 : Read All Status\n");
+    printf("4                 : Reset All\n");
+    printf("5                 : Toggle SD Logging (currently: %s)\n", log_enabled ? "ON" : "OFF");
+    printf("6                 : Stop Trajectory\n");
+    printf("> ");
+}
+
+static void handle_line(char *s) {
+    int mode;
+    if (sscanf(s, "%d", &mode) != 1) { print_menu(); return; }
+
+    if (mode == 1) {
+        float kp, ki, kd;
+        if (sscanf(s, "%*d %f %f %f", &kp, &ki, &kd) != 3 ||
+            kp < 0.0f || kp > 127.996f || ki < 0.0f || ki > 127.996f || kd < 0.0f || kd > 127.996f) {
+            printf("[X] Usage: 1 <Kp> <Ki> <Kd>\n");
+            return;
+        }
+        kp_f = kp; ki_f = ki; kd_f = kd;
+        u32 kpki_val = (float_to_q78(ki_f) << 16) | float_to_q78(kp_f);
+        u32 kd_val   = float_to_q78(kd_f);
+        send_cmd(AMP_CMD_SET_GAINS, 0x3, (s32)kpki_val, (s32)kd_val);
+        printf("[OK] PID Gains sent.\n");
+    }
+    else if (mode == 2) {
+        int target_pos1, target_pos2;
+        if (sscanf(s, "%*d %d %d", &target_pos1, &target_pos2) != 2) {
+            printf("[X] Usage: 2 <pos1> <pos2>\n");
+            return;
+        }
+        s32 q0[AMP_NUM_AXES] = { AMP_SHM->last_act[0], AMP_SHM->last_act[1] };
+        s32 qf[AMP_NUM_AXES] = { target_pos1, target_pos2 };
+
+        // CPU1 이 사용 중이지 않은 슬롯에 계획 후 RUN_PLAN 으로 전달
+        u32 phase_ms = 1000;
+        u32 phase_n = phase_ms * (CMD_FREQ_HZ / 1000);
+        plan_slot ^= 1;
+        traj_profile_t *p = &AMP_SHM->plan[plan_slot];
+        traj_profile_init(p, AMP_NUM_AXES, true);
+        traj_profile_add(p, phase_n, q0, qf);
+        traj_profile_add(p, phase_n, qf, q0);
+        AMP_DMB();
+        send_cmd(AMP_CMD_RUN_PLAN, 0x3, plan_slot, 0);
+        printf("[OK] Trajectory started.\n");
+    }
+    else if (mode == 3) {
+        printf("--- Axis 1 ---\n");
+        printf("Kp=%.3f, Ki=%.3f, Kd=%.3f\n", kp_f, ki_f, kd_f);
+        printf("Desired=%ld, Actual=%ld\n", (long)AMP_SHM->last_des[0], (long)AMP_SHM->last_act[0]);
+        printf("--- Axis 2 ---\n");
+        printf("Kp=%.3f, Ki=%.3f, Kd=%.3f\n", kp_f, ki_f, kd_f);
+        printf("Desired=%ld, Actual=%ld\n", (long)AMP_SHM->last_des[1], (long)AMP_SHM->last_act[1]);
+        printf("--- CPU1 ---\n");
+        printf("ticks=%lu, overruns=%lu\n",
+               (unsigned long)AMP_SHM->tick_count, (unsigned long)AMP_SHM->tick_overruns);
+        printf("cmd ring: overflow=%lu, high=%lu | tlm ring: overflow=%lu, high=%lu, lost=%lu\n",
+               (unsigned long)AMP_SHM->cmd_ring.overflow, (unsigned long)AMP_SHM->cmd_ring.high_water,
+               (unsigned long)AMP_SHM->tlm_ring.overflow, (unsigned long)AMP_SHM->tlm_ring.high_water,
+               (unsigned long)tlm_lost);
+    }
+    else if (mode == 4) {
+        kp_f = ki_f = kd_f = 0.0f;
+        log_header_written = false;
+        send_cmd(AMP_CMD_RESET, 0x3, 0, 0);
+        printf("[OK] All values reset.\n");
+    }
+    else if (mode == 5) {
+        log_flush();
+        log_enabled = !log_enabled;
+        if (log_enabled) {
+            if (log_open_next()) printf("[LOG] ENABLED: %s\n", log_filename);
+            else log_enabled = false;
+        } else {
+            f_close(&fil);
+            printf("[LOG] DISABLED.\n");
+        }
+    }
+    else if (mode == 6) {
+        send_cmd(AMP_CMD_STOP, 0x3, 0, 0);
+        printf("[OK] Stop sent.\n");
+    }
+    else {
+        printf("[X] Invalid input.\n");
+    }
+}
+
+// UART 수신 폴링 (블록하지 않음)
+static void poll_uart(void) {
+    while (XUartPs_IsReceiveData(STDIN_BASEADDRESS)) {
+        char c = (char)XUartPs_ReadReg(STDIN_BASEADDRESS, XUARTPS_FIFO_OFFSET);
+        if (c == '\r' || c == '\n') {
+            outbyte('\r'); outbyte('\n');
+            line[line_len] = '\0';
+            if (line_len > 0) handle_line(line);
+            line_len = 0;
+            print_menu();
+        } else if (line_len < (int)sizeof(line) - 1) {
+            outbyte(c);
+            line[line_len++] = c;
+        }
+    }
+}
+
+int main() {
+    amp_shared_t *shm = AMP_SHM;
+    Xil_SetTlbAttributes(AMP_SHM_BASE, AMP_SHM_TLB_ATTR);
+
+    // 공유 메모리 초기화 후 CPU1 기동
+    memset(shm, 0, sizeof(*shm));
+    amp_ring_init(&shm->cmd_ring, shm->cmd_buf, sizeof(amp_cmd_t), AMP_CMD_SLOTS);
+    amp_ring_init(&shm->tlm_ring, shm->tlm_buf, sizeof(amp_tlm_t), AMP_TLM_SLOTS);
+    AMP_DMB();
+    shm->magic = AMP_MAGIC;
+    start_cpu1();
+
+    // SD 마운트 (프로그램 시작 시 한 번)
+    FRESULT res = f_mount(&fs, "0:", 1);
+    if (res != FR_OK) {
+        printf("[ERR] SD mount failed: %d\n", res);
+        log_enabled = false;
+    } else {
+        printf("[INFO] SD mounted.\n");
+        if (log_open_next()) printf("[INFO] Logging started: %s\n", log_filename);
+        else log_enabled = false;
+    }
+
+    XTime t_wait, now;
+    XTime_GetTime(&t_wait);
+    do {
+        XTime_GetTime(&now);
+    } while (!shm->core1_alive && (now - t_wait) < COUNTS_PER_SECOND);
+    printf(shm->core1_alive ? "[INFO] CPU1 running.\n" : "[ERR] CPU1 not responding.\n");
+
+    print_menu();
+    while (1) {
+        drain_telemetry();
+        poll_uart();
+    }
+    return 0;
+}
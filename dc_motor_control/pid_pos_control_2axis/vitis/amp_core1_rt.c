@@ -0,0 +1,138 @@
+// amp_core1_rt.c: CPU1 실시간 틱 루프 (AMP 구성, amp_shared.h 참고)
+// UART, SD 접근 없음. 명령 링을 비우고, setpoint 출력, 위치 읽기, 텔레메트리 푸시만 수행.
+
+#include <stdbool.h>
+#include <string.h>
+#include "xparameters.h"
+#include "xil_io.h"
+#include "xil_mmu.h"
+#include "xtime_l.h"
+#include "amp_shared.h"
+#include "maxon_regs.h"
+#include "safety.h"
+
+#define BASEADDR1      XPAR_MAXON_TOP_0_BASEADDR
+#define BASEADDR2      XPAR_MAXON_TOP_1_BASEADDR
+
+// 트라젝틱 주파수 (Hz)
+#define CMD_FREQ_HZ    5000
+#define XTIME_PER_CMD  (COUNTS_PER_SECOND / CMD_FREQ_HZ)
+
+static const UINTPTR axis_base[AMP_NUM_AXES] = { BASEADDR1, BASEADDR2 };
+
+static traj_profile_t traj;
+static bool traj_running = false;
+static s32 des[TRAJ_MAX_AXES];
+
+static void handle_cmd(amp_shared_t *shm, const amp_cmd_t *cmd) {
+    switch (cmd->type) {
+    case AMP_CMD_SET_GAINS:
+        for (int i = 0; i < AMP_NUM_AXES; i++) {
+            if (!(cmd->axis_mask & (1U << i))) continue;
+            Xil_Out32(axis_base[i] + REG_KPKI, (u32)cmd->arg[0]);
+            Xil_Out32(axis_base[i] + REG_KD,   (u32)cmd->arg[1]);
+        }
+        break;
+    case AMP_CMD_RUN_PLAN:
+        // CPU0 가 슬롯을 다 채운 뒤 명령을 푸시하므로 여기서 복사해도 안전
+        memcpy(&traj, &shm->plan[cmd->arg[0] & 1], sizeof(traj));
+        traj_profile_rewind(&traj);
+        traj_running = true;
+        break;
+    case AMP_CMD_STOP:
+        traj_running = false;
+        break;
+    case AMP_CMD_RESET:
+        traj_running = false;
+        for (int i = 0; i < AMP_NUM_AXES; i++) {
+            Xil_Out32(axis_base[i] + REG_KPKI, 0);
+            Xil_Out32(axis_base[i] + REG_KD,   0);
+            Xil_Out32(axis_base[i] + REG_DESIRED, 0);
+            des[i] = 0;
+        }
+        break;
+    default:
+        break;
+    }
+}
+
+int main() {
+    amp_shared_t *shm = AMP_SHM;
+    Xil_SetTlbAttributes(AMP_SHM_BASE, AMP_SHM_TLB_ATTR);
+
+    // CPU0 가 공유 메모리와 링을 초기화할 때까지 대기
+    while (shm->magic != AMP_MAGIC);
+    shm->core1_alive = 1;
+
+    // PL 리셋 값은 한계 0 (감시 해제) 이므로 루프 시작 전에 기본 한계로 무장
+    safety_cfg_t safety_cfg;
+    safety_cfg_default(&safety_cfg);
+    for (int i = 0; i < AMP_NUM_AXES; i++)
+        safety_configure(axis_base[i], &safety_cfg);
+
+    XTime t_cmd;
+    XTime_GetTime(&t_cmd);
+    maxon_snapshot_t snap;
+    u64 pl_ts0 = maxon_read_ts(axis_base[0]);
+    u64 ts_ref = pl_ts0;                    // TS_HI 없이 읽는 스냅샷 확장 기준 (매 주기 갱신)
+    XTime interval = (XTime)XTIME_PER_CMD;
+    u32 seq = 0;
+
+    while (1) {
+        XTime now;
+        XTime_GetTime(&now);
+        if ((now - t_cmd) < interval) continue;
+
+        t_cmd += interval;
+        if ((now - t_cmd) >= interval) {
+            // 한 주기 이상 밀렸으면 따라잡지 않고 현재 시각으로 재정렬
+            shm->tick_overruns++;
+            t_cmd = now;
+        }
+
+        amp_cmd_t cmd;
+        while (amp_ring_pop(&shm->cmd_ring, &cmd)) handle_cmd(shm, &cmd);
+
+        // PL 워치독: 이 루프가 멈추면 (CPU1 정지 / 행) PL 이 스스로 출력을 차단
+        for (int i = 0; i < AMP_NUM_AXES; i++)
+            safety_kick(axis_base[i]);
+
+        bool last = false;
+        bool active = traj_running;
+        if (traj_running) {
+            if (traj_profile_step(&traj, des)) {
+                for (int i = 0; i < AMP_NUM_AXES; i++)
+                    Xil_Out32(axis_base[i] + REG_DESIRED, des[i]);
+            }
+            if (traj.cur >= traj.n_segs) {
+                traj_running = false;
+                last = true;
+            }
+        }
+
+        amp_tlm_t tlm;
+        tlm.seq = active ? seq++ : seq;
+        tlm.flags = last ? AMP_TLM_FLAG_LAST : 0;
+        for (int i = 0; i < AMP_NUM_AXES; i++) {
+            // 같은 PL 제어 틱의 desired/actual (축 간 타임스탬프 동일)
+            maxon_read_snapshot_pos(axis_base[i], &snap, ts_ref);
+            if (i == 0) {
+                ts_ref = snap.ts;
+                tlm.t_us = (snap.ts - pl_ts0) / (PL_TS_HZ / 1000000);
+            }
+            tlm.des[i] = snap.desired;
+            tlm.act[i] = snap.actual;
+            shm->last_des[i] = tlm.des[i];
+            shm->last_act[i] = tlm.act[i];
+        }
+        // 가득 차면 버리고 overflow 만 증가 (제어 주기는 절대 대기하지 않음)
+        if (active) amp_ring_push(&shm->tlm_ring, &tlm);
+        if (last) {
+            AMP_DMB();                      // 마지막 샘플 공개 후 완료 표시
+            shm->traj_done++;
+        }
+
+        shm->tick_count++;
+    }
+    return 0;
+}
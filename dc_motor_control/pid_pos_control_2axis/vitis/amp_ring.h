@@ -0,0 +1,64 @@
+// amp_ring.h: CPU0 ↔ CPU1 lock-free SPSC 링 버퍼 (OCM 공유 메모리)
+//
+// 생산자 1개, 소비자 1개 전제. head 는 생산자만, tail 은 소비자만 기록하므로
+// 락 없이 dmb 두 번으로 순서를 보장한다. 가득 차면 밀어넣지 않고 overflow 를
+// 증가시킨다 (생산자는 절대 대기하지 않음 → 실시간 코어가 막히지 않는다).
+
+#ifndef AMP_RING_H
+#define AMP_RING_H
+
+#include <stdbool.h>
+#include <string.h>
+#include "xil_types.h"
+
+#define AMP_DMB() __asm__ __volatile__ ("dmb" : : : "memory")
+
+typedef struct {
+    volatile u32 head;          // 다음 쓰기 위치 (생산자 전용, free-running)
+    u32 pad0[7];                // 32B 캐시 라인 분리
+    volatile u32 tail;          // 다음 읽기 위치 (소비자 전용, free-running)
+    u32 pad1[7];
+    volatile u32 overflow;      // 가득 차서 버린 항목 수 (생산자 전용)
+    volatile u32 high_water;    // 최대 점유 수 (생산자 전용)
+    u32 elem_size;              // 항목 크기 (바이트)
+    u32 mask;                   // capacity - 1 (capacity 는 2의 거듭제곱)
+    u8 *buf;                    // 항목 저장 영역 (capacity * elem_size)
+} amp_ring_t;
+
+static inline void amp_ring_init(amp_ring_t *r, void *buf, u32 elem_size, u32 capacity) {
+    memset(r, 0, sizeof(*r));
+    r->elem_size = elem_size;
+    r->mask = capacity - 1;
+    r->buf = (u8 *)buf;
+    AMP_DMB();
+}
+
+static inline u32 amp_ring_count(const amp_ring_t *r) {
+    return r->head - r->tail;
+}
+
+static inline bool amp_ring_push(amp_ring_t *r, const void *item) {
+    u32 head = r->head;
+    u32 used = head - r->tail;
+    if (used > r->mask) {
+        r->overflow++;
+        return false;
+    }
+    memcpy(r->buf + (head & r->mask) * r->elem_size, item, r->elem_size);
+    AMP_DMB();                  // 데이터 기록 후 head 공개
+    r->head = head + 1;
+    if (used + 1 > r->high_water) r->high_water = used + 1;
+    return true;
+}
+
+static inline bool amp_ring_pop(amp_ring_t *r, void *item) {
+    u32 tail = r->tail;
+    if (tail == r->head) return false;
+    AMP_DMB();                  // head 확인 후 데이터 읽기
+    memcpy(item, r->buf + (tail & r->mask) * r->elem_size, r->elem_size);
+    AMP_DMB();                  // 데이터 읽은 후 슬롯 반환
+    r->tail = tail + 1;
+    return true;
+}
+
+#endif
@@ -0,0 +1,75 @@
+// amp_shared.h: AMP 구성 공유 메모리 레이아웃 (OCM 0xFFFF0000, non-cacheable)
+//
+// CPU1 (amp_core1_rt.c) : 베어메탈 실시간 틱 루프 — setpoint 출력, 위치 읽기, 텔레메트리
+// CPU0 (amp_core0_ui.c) : UART CLI, 트라젝토리 계획, SD 로깅
+//
+// 두 코어는 아래 구조체만 공유한다. 명령은 cmd_ring (CPU0 → CPU1),
+// 텔레메트리는 tlm_ring (CPU1 → CPU0) 으로 전달된다. PL 레지스터는 CPU1 만 접근한다.
+//
+// 빌드: CPU1 애플리케이션은 BSP 에 -DUSE_AMP=1 을 주고, 링커 스크립트의 DDR 시작을
+// AMP_CPU1_START_ADDR 로 옮겨 CPU0 영역과 겹치지 않게 한다.
+
+#ifndef AMP_SHARED_H
+#define AMP_SHARED_H
+
+#include "xil_types.h"
+#include "amp_ring.h"
+#include "trajectory.h"
+
+#define AMP_SHM_BASE        0xFFFF0000U
+#define AMP_SHM_TLB_ATTR    0x14de2         // S=1 TEX=100 AP=11 C=0 B=0 (non-cacheable)
+#define AMP_CPU1_START_REG  0xFFFFFFF0U     // CPU1 은 sev 후 이 주소의 값으로 점프
+#define AMP_CPU1_START_ADDR 0x10000000U     // CPU1 애플리케이션 링크 주소
+#define AMP_MAGIC           0x414D5031U     // "AMP1"
+
+#define AMP_NUM_AXES        2
+#define AMP_CMD_SLOTS       16              // 2의 거듭제곱
+#define AMP_TLM_SLOTS       1024            // 5 kHz 에서 약 200 ms 버퍼
+
+// 명령 (CPU0 → CPU1)
+enum {
+    AMP_CMD_SET_GAINS = 1,                  // arg[0] = KPKI, arg[1] = KD (axis_mask 축에 기록)
+    AMP_CMD_RUN_PLAN,                       // arg[0] = plan 슬롯 번호
+    AMP_CMD_STOP,                           // 트라젝토리 중단 (현재 desired 유지)
+    AMP_CMD_RESET,                          // 게인/desired 0 으로 초기화
+};
+
+typedef struct {
+    u32 type;
+    u32 axis_mask;
+    s32 arg[6];
+} amp_cmd_t;                                // 32 B
+
+// 텔레메트리 (CPU1 → CPU0), 트라젝토리 실행 중 틱마다 1개
+#define AMP_TLM_FLAG_LAST   0x1             // 트라젝토리 마지막 샘플 (링이 넘치면 유실될 수 있음, 완료 판정은 traj_done)
+
+typedef struct {
+    u32 seq;                                // 틱 번호 (누락 검출용)
+    u32 flags;
+    u64 t_us;                               // 샘플 PL 타임스탬프 (us, 스냅샷 기준, 64비트라 장시간 로그에서도 넘치지 않음)
+    s32 des[AMP_NUM_AXES];
+    s32 act[AMP_NUM_AXES];
+} amp_tlm_t;                                // 32 B
+
+typedef struct {
+    volatile u32 magic;                     // CPU0 초기화 완료 표시
+    volatile u32 core1_alive;               // CPU1 기동 확인
+    volatile u32 tick_count;                // CPU1 틱 카운터
+    volatile u32 tick_overruns;             // 주기를 놓친 틱 수
+    volatile u32 traj_done;                 // 트라젝토리 완료 횟수 (마지막 샘플 푸시 후 증가)
+    volatile s32 last_des[AMP_NUM_AXES];    // 최근 상태 (CLI 상태 조회용)
+    volatile s32 last_act[AMP_NUM_AXES];
+
+    amp_ring_t cmd_ring;
+    amp_ring_t tlm_ring;
+
+    // CPU0 가 계획한 트라젝토리 (이중 버퍼, RUN_PLAN 으로 슬롯 전달)
+    traj_profile_t plan[2];
+
+    amp_cmd_t cmd_buf[AMP_CMD_SLOTS];
+    amp_tlm_t tlm_buf[AMP_TLM_SLOTS];
+} amp_shared_t;
+
+#define AMP_SHM ((amp_shared_t *)AMP_SHM_BASE)
+
+#endif
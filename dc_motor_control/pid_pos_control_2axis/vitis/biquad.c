@@ -0,0 +1,66 @@
+// biquad.c: PL biquad 캐스케이드 계수 설계 및 로드
+
+#include <math.h>
+#include "xil_io.h"
+#include "maxon_regs.h"
+#include "biquad.h"
+
+#define BQ_COMMIT_TIMEOUT   100000      // 폴링 횟수 (틱 주기 50 us 대비 충분)
+
+void biquad_notch(biquad_coef_t *c, float f0_hz, float q) {
+    float w0 = 2.0f * (float)M_PI * f0_hz / BQ_FS_HZ;
+    float alpha = sinf(w0) / (2.0f * q);
+    float cw = cosf(w0);
+    float a0 = 1.0f + alpha;
+
+    c->b0 = 1.0f / a0;
+    c->b1 = -2.0f * cw / a0;
+    c->b2 = 1.0f / a0;
+    c->a1 = -2.0f * cw / a0;
+    c->a2 = (1.0f - alpha) / a0;
+}
+
+void biquad_lowpass(biquad_coef_t *c, float f0_hz, float q) {
+    float w0 = 2.0f * (float)M_PI * f0_hz / BQ_FS_HZ;
+    float alpha = sinf(w0) / (2.0f * q);
+    float cw = cosf(w0);
+    float a0 = 1.0f + alpha;
+
+    c->b0 = (1.0f - cw) * 0.5f / a0;
+    c->b1 = (1.0f - cw) / a0;
+    c->b2 = (1.0f - cw) * 0.5f / a0;
+    c->a1 = -2.0f * cw / a0;
+    c->a2 = (1.0f - alpha) / a0;
+}
+
+void biquad_identity(biquad_coef_t *c) {
+    c->b0 = 1.0f;
+    c->b1 = c->b2 = c->a1 = c->a2 = 0.0f;
+}
+
+s32 biquad_q28(float v) {
+    const float lim = 7.999999f;
+    if (v > lim) v = lim;
+    if (v < -lim) v = -lim;
+    return (s32)lrintf(v * (float)(1 << BQ_COEF_FRAC));
+}
+
+void biquad_load_stage(UINTPTR base, int chain, int stage, const biquad_coef_t *c) {
+    Xil_Out32(base + REG_BQ_SEL, ((u32)(chain & 1) << 8) | ((u32)(stage & 0xF) << 4));
+    Xil_Out32(base + REG_BQ_DATA, (u32)biquad_q28(c->b0));
+    Xil_Out32(base + REG_BQ_DATA, (u32)biquad_q28(c->b1));
+    Xil_Out32(base + REG_BQ_DATA, (u32)biquad_q28(c->b2));
+    Xil_Out32(base + REG_BQ_DATA, (u32)biquad_q28(c->a1));
+    Xil_Out32(base + REG_BQ_DATA, (u32)biquad_q28(c->a2));
+}
+
+u32 biquad_enabled(UINTPTR base) {
+    return (Xil_In32(base + REG_BQ_STAT) >> 2) & 0xFFFF;
+}
+
+int biquad_commit(UINTPTR base, u32 enable_mask, bool clear_state) {
+    Xil_Out32(base + REG_BQ_CTRL, 0x80000000U | (clear_state ? 0x40000000U : 0) | (enable_mask & 0xFFFF));
+    for (int i = 0; i < BQ_COMMIT_TIMEOUT; i++)
+        if (!(Xil_In32(base + REG_BQ_STAT) & BQ_STAT_PENDING)) return 0;
+    return -1;
+}
@@ -0,0 +1,52 @@
+// biquad.h: PL biquad 캐스케이드 (biquad_cascade.v) 계수 설계 및 로드
+//
+// 축마다 체인 2개 x 4단. 체인 0 은 제어 출력 (PWM 직전), 체인 1 은 위치 피드백.
+// 계수는 PL 제어 주기 (20 kHz) 기준으로 설계하고 Q4.28 로 변환해 shadow 뱅크에 쓴 뒤
+// commit 하면 다음 틱 전에 모든 단이 한 번에 바뀐다.
+//
+//   biquad_coef_t c;
+//   biquad_notch(&c, 180.0f, 5.0f);
+//   biquad_load_stage(BASEADDR1, BQ_CHAIN_CTRL, 0, &c);
+//   biquad_commit(BASEADDR1, biquad_enabled(BASEADDR1) | BQ_STAGE_BIT(BQ_CHAIN_CTRL, 0), false);
+
+#ifndef BIQUAD_H
+#define BIQUAD_H
+
+#include <stdbool.h>
+#include "xil_types.h"
+
+#define BQ_FS_HZ            20000.0f    // Pid_pos.v 제어 주기
+#define BQ_NUM_STAGES       4
+#define BQ_COEF_FRAC        28          // Q4.28 (|계수| < 8)
+
+#define BQ_CHAIN_CTRL       0           // 제어 출력
+#define BQ_CHAIN_FB         1           // 위치 피드백
+
+#define BQ_STAGE_BIT(chain, stage)  (1U << ((chain) * 8 + (stage)))
+
+#define BQ_STAT_PENDING     0x80000000U
+#define BQ_STAT_SAT_CTRL    0x1U
+#define BQ_STAT_SAT_FB      0x2U
+
+// y = b0 x + b1 x1 + b2 x2 - a1 y1 - a2 y2 (a0 = 1 로 정규화)
+typedef struct {
+    float b0, b1, b2, a1, a2;
+} biquad_coef_t;
+
+// 설계 (RBJ cookbook, fs = BQ_FS_HZ)
+void biquad_notch(biquad_coef_t *c, float f0_hz, float q);
+void biquad_lowpass(biquad_coef_t *c, float f0_hz, float q);
+void biquad_identity(biquad_coef_t *c);
+
+s32 biquad_q28(float v);
+
+// shadow 뱅크에 한 단 기록 (commit 전까지 동작에 영향 없음)
+void biquad_load_stage(UINTPTR base, int chain, int stage, const biquad_coef_t *c);
+
+// 현재 활성 enable 마스크
+u32 biquad_enabled(UINTPTR base);
+
+// shadow 계수와 enable 마스크 일괄 적용 요청, 적용될 때까지 대기 (틱 1개 이내)
+int biquad_commit(UINTPTR base, u32 enable_mask, bool clear_state);
+
+#endif
@@ -0,0 +1,52 @@
+// contour.c: PL 2축 윤곽 제어 설정
+
+#include <math.h>
+#include "xil_io.h"
+#include "maxon_regs.h"
+#include "pid2.h"
+#include "contour.h"
+
+void cc_cfg_default(cc_cfg_t *cfg) {
+    cfg->gain = 0.0f;
+    cfg->vel_shift = 4;                 // 16 틱 (0.8 ms), 5 kHz 목표 갱신의 계단을 편다
+    cfg->limit = 500;
+    cfg->min_speed = 1250.0f;           // 1/16 카운트/틱
+}
+
+int cc_configure(UINTPTR base, const cc_cfg_t *cfg, bool enable) {
+    int err = 0;
+
+    u32 shift = cfg->vel_shift;
+    if (shift > CC_VEL_SHIFT_MAX) { shift = CC_VEL_SHIFT_MAX; err = -1; }
+    u32 limit = cfg->limit;
+    if (limit > 4000) { limit = 4000; err = -1; }
+    if (cfg->gain < 0.0f) err = -1;
+
+    // 카운트/s → Q8.8 카운트/틱
+    float v = cfg->min_speed * 256.0f / CC_FS_HZ;
+    u32 speed = 0;
+    if (v > 65535.0f) { speed = 0xFFFF; err = -1; }
+    else if (v > 0.0f) speed = (u32)lrintf(v);
+
+    Xil_Out32(base + REG_CC_GAIN, pid2_gain_encode(cfg->gain));
+    Xil_Out32(base + REG_CC_LIMIT, (speed << 16) | limit);
+    Xil_Out32(base + REG_CC_CTRL, (shift << 4) | CC_CTRL_CLEAR | (enable ? CC_CTRL_ENABLE : 0));
+    return err;
+}
+
+void cc_enable(UINTPTR base, bool enable) {
+    u32 ctrl = Xil_In32(base + REG_CC_CTRL) & ~(CC_CTRL_ENABLE | CC_CTRL_CLEAR);
+    Xil_Out32(base + REG_CC_CTRL, ctrl | (enable ? CC_CTRL_ENABLE : 0));
+}
+
+void cc_clear(UINTPTR base) {
+    Xil_Out32(base + REG_CC_CTRL, Xil_In32(base + REG_CC_CTRL) | CC_CTRL_CLEAR);
+}
+
+void cc_read(UINTPTR base, cc_status_t *st) {
+    u32 stat = Xil_In32(base + REG_CC_STAT);
+    st->err = (float)(s32)Xil_In32(base + REG_CC_ERR) / 256.0f;
+    st->peak = (float)Xil_In32(base + REG_CC_PEAK) / 256.0f;
+    st->corr = (s16)(stat & 0xFFFF);
+    st->dir_valid = (stat & CC_STAT_DIR_VALID) != 0;
+}
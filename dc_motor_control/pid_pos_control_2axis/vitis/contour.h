@@ -0,0 +1,55 @@
+// contour.h: PL 2축 교차 결합 윤곽 제어 (contour_coupler.v) 설정
+//
+// 목표 경로 접선에 수직인 오차 성분 (윤곽 오차 ε) 을 제어 틱마다 계산해 Kc ε 를 법선 방향으로
+// 두 축 제어 신호에 나눠 더한다. 축별 추종 오차는 그대로 두고 경로 이탈만 줄인다.
+// 설정 레지스터는 축 0 인스턴스 (BASEADDR1) 것만 연결되어 있으므로 base 는 항상 축 0 이다.
+//
+//   cc_cfg_t c;
+//   cc_cfg_default(&c);
+//   c.gain = 2.0f;
+//   cc_configure(BASEADDR1, &c, true);
+//   ... 궤적 실행 ...
+//   cc_status_t st; cc_read(BASEADDR1, &st);     // st.peak: 최대 윤곽 오차 (카운트)
+//
+// ε 부호: 진행 방향 왼쪽 법선 기준 (실제 위치가 경로 오른쪽이면 양수).
+
+#ifndef CONTOUR_H
+#define CONTOUR_H
+
+#include <stdbool.h>
+#include "xil_types.h"
+#include "maxon_regs.h"
+
+#define CC_FS_HZ            20000.0f    // 제어 주기
+#define CC_VEL_SHIFT_MAX    7
+
+#define CC_CTRL_ENABLE      0x1U
+#define CC_CTRL_CLEAR       0x2U
+#define CC_STAT_DIR_VALID   0x10000U
+
+typedef struct {
+    float gain;                 // Kc (제어 단위 / 카운트)
+    u32 vel_shift;              // 목표 속도 필터 2^n 틱 (0 ~ CC_VEL_SHIFT_MAX)
+    u32 limit;                  // |보정| 제한 (제어 단위)
+    float min_speed;            // 이보다 느리면 마지막 경로 방향 유지 (카운트/s, |v_x| + |v_y|)
+} cc_cfg_t;
+
+typedef struct {
+    float err;                  // 윤곽 오차 (카운트)
+    float peak;                 // 초기화 이후 최대 |윤곽 오차|
+    s16 corr;                   // 이 축 보정 (제어 단위)
+    bool dir_valid;             // 경로 방향 확보 (한 번도 움직이지 않았으면 ε = 0)
+} cc_status_t;
+
+void cc_cfg_default(cc_cfg_t *cfg);
+
+// 레지스터 기록 + 상태 초기화. 범위를 벗어난 값이 있으면 -1 (제한해서 기록)
+int cc_configure(UINTPTR base, const cc_cfg_t *cfg, bool enable);
+
+void cc_enable(UINTPTR base, bool enable);
+void cc_clear(UINTPTR base);
+
+// 윤곽 오차 / 최대값은 두 축 인스턴스 공통, 보정은 base 축 것
+void cc_read(UINTPTR base, cc_status_t *st);
+
+#endif
@@ -0,0 +1,60 @@
+// dob.c: PL 외란 관측기 설정
+
+#include <math.h>
+#include "xil_io.h"
+#include "maxon_regs.h"
+#include "dob.h"
+
+void dob_cfg_default(dob_cfg_t *cfg) {
+    plant_param_t prm;
+    plant_param_default(&prm);
+    dob_cfg_from_plant(cfg, &prm);
+    cfg->q_cutoff_hz = 50.0f;
+    cfg->vel_shift = 3;                 // 8 틱 창 (0.4 ms)
+    cfg->limit = 2000;
+}
+
+void dob_cfg_from_plant(dob_cfg_t *cfg, const plant_param_t *prm) {
+    // 제어 단위 1 당 정지 토크 (Nm)
+    float nm_per_unit = prm->kt * prm->supply_v / (prm->r_ohm * PLANT_SIM_CTRL_MAX);
+    cfg->inertia = prm->j / nm_per_unit / prm->counts_per_rad;
+    cfg->damping = (prm->b + prm->kt * prm->kt / prm->r_ohm) / nm_per_unit / prm->counts_per_rad;
+}
+
+// Q16.16 (부호 없음), 범위 초과 시 -1
+static int q1616(float v, u32 *out) {
+    if (v < 0.0f || v >= 65536.0f) return -1;
+    *out = (u32)lrintf(v * 65536.0f);
+    return 0;
+}
+
+int dob_configure(UINTPTR base, const dob_cfg_t *cfg, bool enable) {
+    u32 shift = cfg->vel_shift > DOB_VEL_SHIFT_MAX ? DOB_VEL_SHIFT_MAX : cfg->vel_shift;
+    float alpha = 1.0f - expf(-2.0f * (float)M_PI * cfg->q_cutoff_hz / DOB_FS_HZ);
+    u32 a = (u32)lrintf(alpha * 65536.0f);
+    if (a > 0xFFFF) a = 0xFFFF;
+
+    // 틱 단위: J * fs² (카운트/틱²), B * fs (카운트/틱)
+    u32 kj, b;
+    if (q1616(alpha * cfg->inertia * DOB_FS_HZ * DOB_FS_HZ, &kj) != 0) return -1;
+    if (q1616(cfg->damping * DOB_FS_HZ, &b) != 0) return -1;
+
+    // 보상을 끈 채로 모델을 바꾸고, 추정을 초기화한 뒤 enable
+    u32 ctrl = (a << 16) | (shift << 4);
+    Xil_Out32(base + REG_DOB_CTRL, ctrl);
+    Xil_Out32(base + REG_DOB_KJ, kj);
+    Xil_Out32(base + REG_DOB_B, b);
+    Xil_Out32(base + REG_DOB_LIMIT, cfg->limit > PLANT_SIM_CTRL_MAX ? PLANT_SIM_CTRL_MAX : cfg->limit);
+    Xil_Out32(base + REG_DOB_CTRL, ctrl | DOB_CTRL_CLEAR | (enable ? DOB_CTRL_ENABLE : 0));
+    return 0;
+}
+
+void dob_enable(UINTPTR base, bool enable) {
+    u32 ctrl = Xil_In32(base + REG_DOB_CTRL) & ~(DOB_CTRL_ENABLE | DOB_CTRL_CLEAR);
+    // 켜는 순간의 추정값이 한 번에 들어가지 않도록 초기화와 함께 켠다
+    Xil_Out32(base + REG_DOB_CTRL, ctrl | (enable ? DOB_CTRL_ENABLE | DOB_CTRL_CLEAR : 0));
+}
+
+void dob_clear(UINTPTR base) {
+    Xil_Out32(base + REG_DOB_CTRL, Xil_In32(base + REG_DOB_CTRL) | DOB_CTRL_CLEAR);
+}
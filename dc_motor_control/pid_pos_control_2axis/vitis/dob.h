@@ -0,0 +1,53 @@
+// dob.h: PL 외란 관측기 (disturbance_observer.v) 설정
+//
+// 공칭 모델은 제어 신호 단위 (PWM 카운트) 와 엔코더 카운트로 표현한다.
+//   J : 제어 단위 / (카운트/s²)  — 가속에 필요한 제어 신호
+//   B : 제어 단위 / (카운트/s)   — 속도에 비례하는 제어 신호 (점성 + 역기전력)
+// PL 은 제어 틱 (20 kHz) 단위로 계산하므로 dob_configure() 가 틱 단위 Q16.16 으로 환산한다.
+//
+//   dob_cfg_t c;
+//   dob_cfg_default(&c);                    // plant_sim 공칭 모터 기준
+//   c.q_cutoff_hz = 100.0f;
+//   dob_configure(BASEADDR1, &c, true);
+//
+// Q-filter 차단 주파수를 올리면 부하 변화에 빨리 반응하지만 속도 양자화 잡음도 커진다.
+// 속도 창 (vel_shift) 을 늘리면 잡음은 줄고 추정 지연이 늘어난다 (2^n 틱의 절반).
+
+#ifndef DOB_H
+#define DOB_H
+
+#include <stdbool.h>
+#include "xil_types.h"
+#include "maxon_regs.h"
+#include "plant_sim.h"
+
+#define DOB_FS_HZ           20000.0f    // Pid_pos.v 제어 주기
+#define DOB_VEL_SHIFT_MAX   4
+
+#define DOB_CTRL_ENABLE     0x1U
+#define DOB_CTRL_CLEAR      0x2U
+
+typedef struct {
+    float inertia;              // J (제어 단위 / (카운트/s²))
+    float damping;              // B (제어 단위 / (카운트/s))
+    float q_cutoff_hz;          // Q-filter 대역폭
+    u32 vel_shift;              // 속도 창 2^n 틱 (0 ~ DOB_VEL_SHIFT_MAX)
+    u32 limit;                  // |보상| 제한 (제어 단위)
+} dob_cfg_t;
+
+void dob_cfg_default(dob_cfg_t *cfg);
+
+// 물리 파라미터 (SI) → 제어 단위 공칭 모델 (PWM 전압 구동, 정지 전류 기준 토크 환산)
+void dob_cfg_from_plant(dob_cfg_t *cfg, const plant_param_t *prm);
+
+// 레지스터 기록 + 추정 초기화. 환산값이 레지스터 범위를 넘으면 -1 (기록 안 함)
+int dob_configure(UINTPTR base, const dob_cfg_t *cfg, bool enable);
+
+void dob_enable(UINTPTR base, bool enable);
+void dob_clear(UINTPTR base);
+
+static inline s32 dob_read_est(UINTPTR base) {
+    return (s32)Xil_In32(base + REG_DOB_EST);
+}
+
+#endif
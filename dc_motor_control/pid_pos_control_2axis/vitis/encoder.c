@@ -0,0 +1,60 @@
+// encoder.c: PL 엔코더 프런트엔드 설정 / 상태 / Index 원점
+
+#include "xparameters.h"
+#include "xtime_l.h"
+#include "encoder.h"
+
+void enc_cfg_default(enc_cfg_t *cfg) {
+    cfg->filter_depth = 4;              // 40 ns (엣지 간격 1 us 이상에서 여유)
+    cfg->mode = ENC_MODE_X4;
+    cfg->index_cpr = 2048;              // x4 기준 카운트/rev
+    cfg->index_tol = 2;
+}
+
+void enc_configure(UINTPTR base, const enc_cfg_t *cfg) {
+    u32 depth = cfg->filter_depth > 0xFF ? 0xFF : cfg->filter_depth;
+    u32 cpr = cfg->index_cpr > 0xFFFF ? 0xFFFF : cfg->index_cpr;
+    u32 tol = cfg->index_tol > 0xFF ? 0xFF : cfg->index_tol;
+
+    Xil_Out32(base + REG_ENC_INDEX, (tol << 16) | cpr);
+    Xil_Out32(base + REG_ENC_CTRL, ((cfg->mode & 0x3) << 8) | depth);
+}
+
+void enc_read(UINTPTR base, enc_status_t *st) {
+    st->stat = Xil_In32(base + REG_ENC_STAT) & 0x7;
+    st->invalid = Xil_In32(base + REG_ENC_INVALID);
+    st->position = maxon_read_position64(base);
+    st->index_position = maxon_read_index64(base);
+}
+
+void enc_clear(UINTPTR base) {
+    u32 ctrl = Xil_In32(base + REG_ENC_CTRL) & 0x3FF;
+    Xil_Out32(base + REG_ENC_CTRL, ctrl | ENC_CTRL_CLEAR);
+}
+
+int enc_home_index(UINTPTR base, s32 step, u32 period_us, u32 max_travel, s64 *index_pos) {
+    s32 start = (s32)Xil_In32(base + REG_DESIRED);
+    s32 target = start;
+    u32 travel = 0;
+    XTime t0, t1;
+
+    // Index 래치 상태만 새로 보기 위해 클리어 (무효 전이 카운트도 함께 초기화됨)
+    enc_clear(base);
+
+    while (!(Xil_In32(base + REG_ENC_STAT) & ENC_STAT_INDEX_SEEN)) {
+        if (travel >= max_travel) {
+            Xil_Out32(base + REG_DESIRED, (u32)start);
+            return -1;
+        }
+        target += step;
+        travel += (u32)(step < 0 ? -step : step);
+        Xil_Out32(base + REG_DESIRED, (u32)target);
+
+        XTime_GetTime(&t0);
+        do { XTime_GetTime(&t1); } while (t1 - t0 < (XTime)COUNTS_PER_SECOND * period_us / 1000000);
+    }
+
+    *index_pos = maxon_read_index64(base);
+    Xil_Out32(base + REG_DESIRED, (u32)*index_pos);
+    return 0;
+}
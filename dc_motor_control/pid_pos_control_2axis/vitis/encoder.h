@@ -0,0 +1,52 @@
+// encoder.h: PL 엔코더 프런트엔드 (M_ENC_3ff.v) 설정 / 상태 / Index 원점
+//
+// 필터 깊이는 클럭 (10 ns) 단위로, 최소 엣지 간격의 절반 이하로 둔다 (0 = 필터 없음, 최소 지연).
+// 필터 / 디코드 모드는 축이 정지한 상태에서 바꾼다. 모드를 바꾸면 카운트/rev 가 달라지므로
+// index_cpr 도 같은 기준으로 맞춰야 간격 검사가 오탐하지 않는다.
+//
+// Index 는 위치를 고치지 않고 래치만 한다. 원점이 필요하면 enc_home_index() 로 래치 위치를 찾고
+// 소프트웨어에서 오프셋으로 쓴다 (PL 위치 / 목표는 연속 유지).
+
+#ifndef ENCODER_H
+#define ENCODER_H
+
+#include <stdbool.h>
+#include "xil_types.h"
+#include "xil_io.h"
+#include "maxon_regs.h"
+
+#define ENC_MODE_X4         0
+#define ENC_MODE_X2         1
+#define ENC_MODE_X1         2
+
+#define ENC_CTRL_CLEAR      0x80000000U
+#define ENC_STAT_INVALID    0x01
+#define ENC_STAT_INDEX_ERR  0x02
+#define ENC_STAT_INDEX_SEEN 0x04
+
+typedef struct {
+    u32 filter_depth;           // 클럭 (0 ~ 255)
+    u32 mode;                   // ENC_MODE_*
+    u32 index_cpr;              // Index 간 카운트 (0 = 검사 안 함)
+    u32 index_tol;              // 허용 오차 (카운트)
+} enc_cfg_t;
+
+typedef struct {
+    u32 stat;                   // ENC_STAT_*
+    u32 invalid;                // 무효 전이 수
+    s64 position;
+    s64 index_position;         // 마지막 Index 위치 (ENC_STAT_INDEX_SEEN 일 때만 유효)
+} enc_status_t;
+
+void enc_cfg_default(enc_cfg_t *cfg);
+void enc_configure(UINTPTR base, const enc_cfg_t *cfg);
+void enc_read(UINTPTR base, enc_status_t *st);
+
+// 무효 전이 수 / 오류 플래그 / Index 래치 상태 클리어 (safety 엔코더 트립 해제 전에 호출)
+void enc_clear(UINTPTR base);
+
+// 목표 위치를 step 카운트씩 period_us 마다 옮기며 Index 를 찾는다 (최대 max_travel 카운트).
+// 찾으면 그 자리에서 멈추고 Index 위치를 *index_pos 에 돌려준다. 못 찾으면 시작 위치로 돌아가 -1
+int enc_home_index(UINTPTR base, s32 step, u32 period_us, u32 max_travel, s64 *index_pos);
+
+#endif
@@ -0,0 +1,342 @@
+// gain_sweep.c: 무인 게인 스윕 엔진 구현
+
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+#include "gain_sweep.h"
+#include "trajectory.h"
+
+#define SWEEP_COST_UNSETTLED   1e9f     // 정착 실패 벌점 (ITAE 에 가산)
+#define SWEEP_COST_ABORTED     1e30f    // 발산 / 중단
+#define SWEEP_HOME_SETTLE_N    50       // 홈 정착 판정 연속 샘플 수
+
+static const char *const gain_name[SWEEP_NUM_GAINS] = { "Kp", "Ki", "Kd" };
+
+void sweep_cfg_default(sweep_cfg_t *cfg) {
+    memset(cfg, 0, sizeof(*cfg));
+    cfg->n_axes = SWEEP_MAX_AXES;
+    cfg->method = SWEEP_GRID;
+    cfg->scenario = SWEEP_QUINTIC;
+    for (int a = 0; a < SWEEP_MAX_AXES; a++) {
+        sweep_range_t *r = &cfg->range[a];
+        r->lo[SWEEP_KP] = 0.5f;  r->hi[SWEEP_KP] = 4.0f;  r->steps[SWEEP_KP] = 5;
+        r->lo[SWEEP_KI] = 0.0f;  r->hi[SWEEP_KI] = 0.02f; r->steps[SWEEP_KI] = 3;
+        r->lo[SWEEP_KD] = 0.0f;  r->hi[SWEEP_KD] = 8.0f;  r->steps[SWEEP_KD] = 3;
+        cfg->target[a] = 10000;
+    }
+    cfg->adapt_rounds = 3;
+    cfg->adapt_shrink = 0.5f;
+    cfg->cmd_hz = 5000;
+    cfg->move_n = 5000;                 // 1 s
+    cfg->hold_n = 2500;                 // 0.5 s
+    cfg->home_kpki = sweep_gain_q78(2.0f);
+    cfg->home_kd = sweep_gain_q78(4.0f);
+    cfg->home_move_n = 5000;
+    cfg->home_band = 50;
+    cfg->home_timeout_n = 15000;        // 3 s
+    cfg->abort_err = 20000;
+    cfg->band_pct = 2.0f;
+}
+
+u32 sweep_gain_q78(float v) {
+    if (v < 0.0f) v = 0.0f;
+    if (v > SWEEP_GAIN_MAX) v = SWEEP_GAIN_MAX;
+    return ((u32)(v * 256.0f)) & 0x7FFF;
+}
+
+static inline s32 iabs(s32 v) { return v < 0 ? -v : v; }
+
+// ---------------------------------------------------------------- 지표
+
+void sweep_metrics_begin(sweep_metrics_t *m, s32 y0, s32 target) {
+    float g[SWEEP_NUM_GAINS];
+    memcpy(g, m->gain, sizeof(g));
+    memset(m, 0, sizeof(*m));
+    memcpy(m->gain, g, sizeof(g));
+    m->y0 = y0;
+    m->target = target;
+    m->t10 = m->t90 = m->last_out = -1;
+}
+
+void sweep_metrics_sample(sweep_metrics_t *m, const sweep_cfg_t *cfg, s32 desired, s32 actual) {
+    const s32 i = (s32)m->n++;
+    const s32 sgn = m->target >= m->y0 ? 1 : -1;
+    const s32 step = sgn * (m->target - m->y0);
+    const s32 v = sgn * (actual - m->y0);
+    const s32 e = iabs(desired - actual);
+    const double dt = 1.0 / cfg->cmd_hz;
+
+    m->iae += e * dt;
+    m->itae += (i * dt) * e * dt;
+    m->sq_err += (double)e * e;
+    if (e > m->max_err) m->max_err = e;
+
+    if (m->t10 < 0 && 10 * (s64)v >= (s64)step) m->t10 = i;
+    if (m->t90 < 0 && 10 * (s64)v >= 9 * (s64)step) m->t90 = i;
+    if (sgn * (actual - m->target) > m->peak) m->peak = sgn * (actual - m->target);
+
+    s32 band = (s32)(step * cfg->band_pct / 100.0f);
+    if (band < 1) band = 1;
+    if (iabs(actual - m->target) > band) m->last_out = i;
+}
+
+void sweep_metrics_finish(sweep_metrics_t *m, const sweep_cfg_t *cfg) {
+    const float dt_ms = 1000.0f / cfg->cmd_hz;
+    const s32 step = iabs(m->target - m->y0);
+
+    m->rise_ms = (m->t10 >= 0 && m->t90 >= 0) ? (m->t90 - m->t10) * dt_ms : -1.0f;
+    m->overshoot_pct = step > 0 ? 100.0f * m->peak / step : 0.0f;
+    bool settled = m->n > 0 && (u32)(m->last_out + 1) < m->n;
+    m->settle_ms = settled ? (m->last_out + 1) * dt_ms : -1.0f;
+    m->rms_err = m->n ? (float)sqrt(m->sq_err / m->n) : 0.0f;
+
+    m->cost = (float)m->itae;
+    if (!settled) m->cost += SWEEP_COST_UNSETTLED;
+    if (m->aborted) m->cost = SWEEP_COST_ABORTED;
+}
+
+// ---------------------------------------------------------------- 실행
+
+typedef struct {
+    const sweep_cfg_t *cfg;
+    const sweep_backend_t *be;
+    const sweep_io_t *io;
+    bool sum_open, log_open;
+    char line[160];
+} sweep_ctx_t;
+
+// 안전 게인으로 현재 위치 → 홈 quintic 이동 후 정착 대기
+static int go_home(sweep_ctx_t *c) {
+    const sweep_cfg_t *cfg = c->cfg;
+    const sweep_backend_t *be = c->be;
+    s32 q0[TRAJ_MAX_AXES] = { 0 }, qf[TRAJ_MAX_AXES] = { 0 }, des[TRAJ_MAX_AXES];
+    traj_profile_t traj;
+
+    for (int a = 0; a < cfg->n_axes; a++) {
+        s32 d;
+        be->read(be->ctx, a, &d, &q0[a]);
+        qf[a] = cfg->home[a];
+        be->set_desired(be->ctx, a, q0[a]);         // 현재 위치에서 시작 (점프 방지)
+        be->set_gains(be->ctx, a, cfg->home_kpki, cfg->home_kd);
+    }
+
+    traj_profile_init(&traj, cfg->n_axes, true);
+    traj_profile_add(&traj, cfg->home_move_n ? cfg->home_move_n : 1, q0, qf);
+    while (traj_profile_step(&traj, des)) {
+        be->wait_cmd(be->ctx);
+        for (int a = 0; a < cfg->n_axes; a++) be->set_desired(be->ctx, a, des[a]);
+    }
+
+    u32 in_band = 0;
+    for (u32 n = 0; n < cfg->home_timeout_n; n++) {
+        be->wait_cmd(be->ctx);
+        bool ok = true;
+        for (int a = 0; a < cfg->n_axes; a++) {
+            s32 d, y;
+            be->read(be->ctx, a, &d, &y);
+            if (iabs(y - cfg->home[a]) > cfg->home_band) ok = false;
+        }
+        in_band = ok ? in_band + 1 : 0;
+        if (in_band >= SWEEP_HOME_SETTLE_N) return 0;
+    }
+    return -1;
+}
+
+static void log_sample(sweep_ctx_t *c, u32 n, const sweep_metrics_t *m, const s32 *des, const s32 *act) {
+    const u32 us = (u32)((u64)n * 1000000 / c->cfg->cmd_hz);
+    const u32 dus = 1000000 / c->cfg->cmd_hz;
+    int len = snprintf(c->line, sizeof(c->line), "%lu.%03lu,%lu.%03lu,%.3f,%.3f,%.3f",
+                       (unsigned long)(us / 1000), (unsigned long)(us % 1000),
+                       (unsigned long)(dus / 1000), (unsigned long)(dus % 1000),
+                       m->gain[SWEEP_KP], m->gain[SWEEP_KI], m->gain[SWEEP_KD]);
+    for (int a = 0; a < c->cfg->n_axes; a++)
+        len += snprintf(c->line + len, sizeof(c->line) - len, ",%d,%d,%d",
+                        (int)des[a], (int)act[a], (int)(des[a] - act[a]));
+    c->line[len++] = '\n';
+    c->io->write(c->io->ctx, SWEEP_FILE_RUN, c->line, len);
+}
+
+// 한 점 실행 (모든 축 동시). m[a].gain 에 후보 게인이 들어 있어야 함
+static void run_point(sweep_ctx_t *c, u32 run_idx, sweep_metrics_t *m) {
+    const sweep_cfg_t *cfg = c->cfg;
+    const sweep_backend_t *be = c->be;
+    s32 q0[TRAJ_MAX_AXES] = { 0 }, qf[TRAJ_MAX_AXES] = { 0 };
+    s32 des[TRAJ_MAX_AXES], act[TRAJ_MAX_AXES];
+    traj_profile_t traj;
+
+    c->log_open = false;
+    if (cfg->log_runs && c->io) {
+        char name[12];      // "SWxxx.CSV"
+        snprintf(name, sizeof(name), "SW%03lu.CSV", (unsigned long)(run_idx % 1000));
+        if (c->io->open(c->io->ctx, SWEEP_FILE_RUN, name) == 0) {
+            c->log_open = true;
+            int len = snprintf(c->line, sizeof(c->line), "Time_ms,Delta_ms,Kp,Ki,Kd");
+            for (int a = 0; a < cfg->n_axes; a++)
+                len += snprintf(c->line + len, sizeof(c->line) - len, ",Des%d,Act%d,Err%d", a + 1, a + 1, a + 1);
+            c->line[len++] = '\n';
+            c->io->write(c->io->ctx, SWEEP_FILE_RUN, c->line, len);
+        }
+    }
+
+    for (int a = 0; a < cfg->n_axes; a++) {
+        s32 d;
+        be->read(be->ctx, a, &d, &q0[a]);
+        qf[a] = cfg->target[a];
+        sweep_metrics_begin(&m[a], q0[a], qf[a]);
+        be->set_gains(be->ctx, a,
+                      (sweep_gain_q78(m[a].gain[SWEEP_KI]) << 16) | sweep_gain_q78(m[a].gain[SWEEP_KP]),
+                      sweep_gain_q78(m[a].gain[SWEEP_KD]));
+    }
+
+    u32 total = cfg->hold_n;
+    if (cfg->scenario == SWEEP_QUINTIC) {
+        traj_profile_init(&traj, cfg->n_axes, true);
+        traj_profile_add(&traj, cfg->move_n ? cfg->move_n : 1, q0, qf);
+        total += traj_profile_length(&traj);
+    }
+
+    int active = cfg->n_axes;
+    bool moving = cfg->scenario == SWEEP_QUINTIC;
+    for (u32 n = 0; n < total && active > 0; n++) {
+        if (moving) moving = traj_profile_step(&traj, des);
+        if (!moving) memcpy(des, qf, sizeof(des));
+
+        be->wait_cmd(be->ctx);
+        for (int a = 0; a < cfg->n_axes; a++)
+            if (!m[a].aborted) be->set_desired(be->ctx, a, des[a]);
+
+        for (int a = 0; a < cfg->n_axes; a++) {
+            s32 d;
+            be->read(be->ctx, a, &d, &act[a]);
+            des[a] = d;         // 제어기가 실제로 사용한 목표 (스냅샷)
+            if (m[a].aborted) continue;
+            sweep_metrics_sample(&m[a], cfg, d, act[a]);
+            if (iabs(d - act[a]) > cfg->abort_err) {
+                // 발산: 해당 축만 안전 게인으로 현재 위치 유지
+                m[a].aborted = true;
+                be->set_gains(be->ctx, a, cfg->home_kpki, cfg->home_kd);
+                be->set_desired(be->ctx, a, act[a]);
+                active--;
+            }
+        }
+        if (c->log_open) log_sample(c, n, &m[0], des, act);
+    }
+
+    if (c->log_open) c->io->close(c->io->ctx, SWEEP_FILE_RUN);
+    for (int a = 0; a < cfg->n_axes; a++) sweep_metrics_finish(&m[a], cfg);
+}
+
+// 격자 인덱스 → 게인 (축 범위별)
+static u32 grid_points(const sweep_range_t *r) {
+    u32 n = 1;
+    for (int g = 0; g < SWEEP_NUM_GAINS; g++) n *= r->steps[g] ? r->steps[g] : 1;
+    return n;
+}
+
+static void grid_gain(const sweep_range_t *r, u32 idx, float *gain) {
+    for (int g = 0; g < SWEEP_NUM_GAINS; g++) {
+        u32 s = r->steps[g] ? r->steps[g] : 1;
+        u32 k = idx % s;
+        idx /= s;
+        gain[g] = s > 1 ? r->lo[g] + (r->hi[g] - r->lo[g]) * k / (s - 1) : r->lo[g];
+    }
+}
+
+static void write_summary_row(sweep_ctx_t *c, u32 run, int axis, const sweep_metrics_t *m) {
+    if (!c->sum_open) return;
+    const char *st = m->aborted ? "abort" : (m->settle_ms < 0.0f ? "unsettled" : "ok");
+    int len = snprintf(c->line, sizeof(c->line), "%lu,%d,%.3f,%.3f,%.3f,%.3f,%.2f,%.3f,%.4g,%.4g,%ld,%.2f,%s\n",
+                       (unsigned long)run, axis + 1, m->gain[SWEEP_KP], m->gain[SWEEP_KI], m->gain[SWEEP_KD],
+                       m->rise_ms, m->overshoot_pct, m->settle_ms, m->iae, m->itae,
+                       (long)m->max_err, m->rms_err, st);
+    c->io->write(c->io->ctx, SWEEP_FILE_SUMMARY, c->line, len);
+}
+
+int sweep_run(const sweep_cfg_t *cfg, const sweep_backend_t *be, const sweep_io_t *io,
+              int summary_idx, sweep_result_t *res) {
+    sweep_ctx_t c;
+    sweep_range_t range[SWEEP_MAX_AXES];
+    sweep_metrics_t m[SWEEP_MAX_AXES];
+    int ret = 0;
+
+    memset(&c, 0, sizeof(c));
+    c.cfg = cfg;
+    c.be = be;
+    c.io = io;
+    memset(res, 0, sizeof(*res));
+    for (int a = 0; a < cfg->n_axes; a++) res->best[a].cost = SWEEP_COST_ABORTED * 2;
+    memcpy(range, cfg->range, sizeof(range));
+
+    if (io) {
+        char name[12];      // "SWSUMxx.CSV"
+        snprintf(name, sizeof(name), "SWSUM%02d.CSV", summary_idx % 100);
+        if (io->open(io->ctx, SWEEP_FILE_SUMMARY, name) == 0) {
+            c.sum_open = true;
+            int len = snprintf(c.line, sizeof(c.line),
+                               "run,axis,kp,ki,kd,rise_ms,overshoot_pct,settle_ms,iae,itae,max_err,rms_err,status\n");
+            io->write(io->ctx, SWEEP_FILE_SUMMARY, c.line, len);
+        }
+    }
+
+    u32 rounds = cfg->method == SWEEP_ADAPTIVE ? (cfg->adapt_rounds ? cfg->adapt_rounds : 1) : 1;
+    u32 run = 1;
+    for (u32 r = 0; r < rounds && ret == 0; r++) {
+        // 축마다 점 수가 다르면 적은 쪽은 격자를 반복
+        u32 n_pts = 0, pts[SWEEP_MAX_AXES];
+        for (int a = 0; a < cfg->n_axes; a++) {
+            pts[a] = grid_points(&range[a]);
+            if (pts[a] > n_pts) n_pts = pts[a];
+        }
+
+        for (u32 p = 0; p < n_pts; p++, run++) {
+            if (go_home(&c) != 0) {
+                printf("[SWEEP] homing failed before run %lu, abort.\n", (unsigned long)run);
+                res->homing_failed = true;
+                ret = -1;
+                break;
+            }
+            for (int a = 0; a < cfg->n_axes; a++) grid_gain(&range[a], p % pts[a], m[a].gain);
+            run_point(&c, run, m);
+            res->runs++;
+
+            for (int a = 0; a < cfg->n_axes; a++) {
+                write_summary_row(&c, run, a, &m[a]);
+                if (m[a].aborted) res->aborted++;
+                if (m[a].cost < res->best[a].cost) res->best[a] = m[a];
+                printf("[SWEEP] run %lu axis %d: Kp=%.3f Ki=%.3f Kd=%.3f ITAE=%.4g OS=%.1f%% Ts=%.1f ms%s\n",
+                       (unsigned long)run, a + 1, m[a].gain[SWEEP_KP], m[a].gain[SWEEP_KI], m[a].gain[SWEEP_KD],
+                       m[a].itae, m[a].overshoot_pct, m[a].settle_ms, m[a].aborted ? " (abort)" : "");
+            }
+        }
+
+        // 최적점 중심으로 범위 축소 (게인 한계 안으로 자름)
+        for (int a = 0; a < cfg->n_axes; a++) {
+            if (res->best[a].cost >= SWEEP_COST_ABORTED) continue;
+            for (int g = 0; g < SWEEP_NUM_GAINS; g++) {
+                if (range[a].steps[g] <= 1) continue;
+                float half = 0.5f * (range[a].hi[g] - range[a].lo[g]) * cfg->adapt_shrink;
+                float ctr = res->best[a].gain[g];
+                range[a].lo[g] = ctr - half < 0.0f ? 0.0f : ctr - half;
+                range[a].hi[g] = ctr + half > SWEEP_GAIN_MAX ? SWEEP_GAIN_MAX : ctr + half;
+            }
+        }
+    }
+
+    if (c.sum_open) io->close(io->ctx, SWEEP_FILE_SUMMARY);
+
+    // 홈 정지 후 축별 최적 게인 적용 (유효한 실행이 없으면 안전 게인 유지)
+    if (ret == 0 && go_home(&c) != 0) {
+        res->homing_failed = true;
+        ret = -1;
+    }
+    for (int a = 0; a < cfg->n_axes && ret == 0; a++) {
+        const sweep_metrics_t *b = &res->best[a];
+        if (b->cost >= SWEEP_COST_ABORTED) continue;
+        be->set_gains(be->ctx, a, (sweep_gain_q78(b->gain[SWEEP_KI]) << 16) | sweep_gain_q78(b->gain[SWEEP_KP]),
+                      sweep_gain_q78(b->gain[SWEEP_KD]));
+        printf("[SWEEP] axis %d best: %s=%.3f %s=%.3f %s=%.3f (ITAE=%.4g)\n", a + 1,
+               gain_name[SWEEP_KP], b->gain[SWEEP_KP], gain_name[SWEEP_KI], b->gain[SWEEP_KI],
+               gain_name[SWEEP_KD], b->gain[SWEEP_KD], b->itae);
+    }
+    return ret;
+}
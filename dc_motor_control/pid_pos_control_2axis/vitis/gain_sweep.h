@@ -0,0 +1,117 @@
+// gain_sweep.h: 무인 게인 스윕 엔진 (실기 / 시뮬레이션 공용)
+//
+// 각 점마다: 안전 게인으로 홈 복귀 → 정착 확인 → 후보 게인 적용 → 시나리오 (스텝 또는 quintic)
+// 실행 → 지표 계산. 지표는 샘플마다 누적 계산하므로 로그를 남기지 않아도 되고,
+// SD 에는 요약 (SWSUMxx.CSV) 만 필요하다. 실행별 원시 로그 (SWxxx.CSV) 는 선택.
+//
+// 하드웨어 접근은 sweep_backend_t 로만 하므로 같은 스윕을 실기 (REG_*) 와
+// plant_sim (PL 제어기 + 모터 모델) 에 동일하게 돌릴 수 있다.
+// 축은 서로 독립이므로 모든 축이 같은 점 인덱스에서 각자의 범위로 동시에 스윕된다.
+
+#ifndef GAIN_SWEEP_H
+#define GAIN_SWEEP_H
+
+#include <stdbool.h>
+#include "xil_types.h"
+
+#define SWEEP_MAX_AXES  2
+#define SWEEP_GAIN_MAX  127.996f
+
+enum { SWEEP_KP = 0, SWEEP_KI, SWEEP_KD, SWEEP_NUM_GAINS };
+
+typedef enum {
+    SWEEP_GRID = 0,             // lo..hi 균등 격자 전체
+    SWEEP_ADAPTIVE,             // 격자 → 최적점 중심으로 범위 축소 반복
+} sweep_method_t;
+
+typedef enum {
+    SWEEP_STEP = 0,
+    SWEEP_QUINTIC,
+} sweep_scenario_t;
+
+// 실기 / 시뮬레이션 접근 (모든 함수 필수)
+typedef struct {
+    void (*set_gains)(void *ctx, int axis, u32 kpki, u32 kd);
+    void (*set_desired)(void *ctx, int axis, s32 pos);
+    void (*read)(void *ctx, int axis, s32 *desired, s32 *actual);
+    void (*wait_cmd)(void *ctx);        // 다음 명령 주기까지 대기 (시뮬레이션은 플랜트 진행)
+    void *ctx;
+} sweep_backend_t;
+
+// 파일 출력 (NULL 이면 기록 안 함). 요약과 실행 로그가 동시에 열리므로 파일 슬롯으로 구분
+enum { SWEEP_FILE_SUMMARY = 0, SWEEP_FILE_RUN, SWEEP_NUM_FILES };
+
+typedef struct {
+    int (*open)(void *ctx, int slot, const char *name);    // 0 = 성공
+    void (*write)(void *ctx, int slot, const char *buf, int len);
+    void (*close)(void *ctx, int slot);
+    void *ctx;
+} sweep_io_t;
+
+typedef struct {
+    float lo[SWEEP_NUM_GAINS];
+    float hi[SWEEP_NUM_GAINS];
+    u32 steps[SWEEP_NUM_GAINS];         // 격자 점 수 (1 = lo 고정)
+} sweep_range_t;
+
+typedef struct {
+    int n_axes;
+    sweep_method_t method;
+    sweep_scenario_t scenario;
+    sweep_range_t range[SWEEP_MAX_AXES];
+    u32 adapt_rounds;                   // SWEEP_ADAPTIVE 반복 횟수
+    float adapt_shrink;                 // 반복마다 범위 축소 비율 (0.3 ~ 0.7)
+
+    u32 cmd_hz;                         // 명령 주기 (시간 지표 환산용)
+    s32 home[SWEEP_MAX_AXES];           // 실행 시작 위치
+    s32 target[SWEEP_MAX_AXES];         // 실행 목표 위치
+    u32 move_n;                         // quintic 이동 샘플 수 (스텝은 무시)
+    u32 hold_n;                         // 목표 도달 후 관측 샘플 수
+
+    u32 home_kpki, home_kd;             // 홈 복귀용 안전 게인
+    u32 home_move_n;                    // 홈 복귀 quintic 샘플 수
+    s32 home_band;                      // 홈 정착 판정 (카운트)
+    u32 home_timeout_n;                 // 정착 대기 한도 (넘으면 스윕 중단)
+    s32 abort_err;                      // 추종 오차가 넘으면 실행 즉시 중단 (발산 보호)
+
+    float band_pct;                     // settling 허용 폭 (% of step, 최소 1 카운트)
+    bool log_runs;                      // 실행별 원시 로그 SWxxx.CSV
+} sweep_cfg_t;
+
+// 실행 x 축 지표 (샘플마다 누적)
+typedef struct {
+    float gain[SWEEP_NUM_GAINS];
+    s32 y0, target;
+    u32 n;
+    s32 t10, t90, last_out;             // 샘플 인덱스 (-1 = 없음)
+    s32 peak;                           // 목표 방향 최대 초과량 (카운트)
+    s32 max_err;
+    double iae, itae, sq_err;
+    bool aborted;
+
+    // 요약 (sweep_metrics_finish 후 유효)
+    float rise_ms, overshoot_pct, settle_ms, rms_err, cost;
+} sweep_metrics_t;
+
+typedef struct {
+    u32 runs;
+    u32 aborted;
+    bool homing_failed;
+    sweep_metrics_t best[SWEEP_MAX_AXES];
+} sweep_result_t;
+
+void sweep_cfg_default(sweep_cfg_t *cfg);
+
+// Q7.8 변환 (REG_KPKI / REG_KD 포맷)
+u32 sweep_gain_q78(float v);
+
+void sweep_metrics_begin(sweep_metrics_t *m, s32 y0, s32 target);
+void sweep_metrics_sample(sweep_metrics_t *m, const sweep_cfg_t *cfg, s32 desired, s32 actual);
+void sweep_metrics_finish(sweep_metrics_t *m, const sweep_cfg_t *cfg);
+
+// 스윕 실행. summary_idx 로 SWSUMxx.CSV, 실행 로그는 SW001.CSV 부터 번호를 매긴다.
+// 끝나면 축별 최적 게인을 적용하고 홈에 정지한다. 홈 복귀 실패 시 즉시 중단 (-1).
+int sweep_run(const sweep_cfg_t *cfg, const sweep_backend_t *be, const sweep_io_t *io,
+              int summary_idx, sweep_result_t *res);
+
+#endif
@@ -0,0 +1,94 @@
+// ilc.c: 반복 학습 제어 구현
+
+#include <math.h>
+#include <string.h>
+#include "ilc.h"
+
+void ilc_cfg_default(ilc_cfg_t *cfg, u32 sample_hz) {
+    cfg->gain = 0.3f;
+    cfg->lead = 30;                 // 5 kHz 에서 6 ms (폐루프 위상 지연 보상)
+    cfg->q_cutoff_hz = 20.0f;
+    cfg->sample_hz = sample_hz;
+    cfg->max_corr = 5000;
+    cfg->diverge_ratio = 1.2f;
+}
+
+int ilc_init(ilc_axis_t *ilc, const ilc_cfg_t *cfg, u32 n_samples) {
+    if (n_samples == 0 || n_samples > ILC_MAX_SAMPLES) return -1;
+    ilc->cfg = *cfg;
+    ilc->n = n_samples;
+    ilc_reset(ilc);
+    return 0;
+}
+
+void ilc_reset(ilc_axis_t *ilc) {
+    memset(ilc->u, 0, sizeof(ilc->u));
+    memset(ilc->u_best, 0, sizeof(ilc->u_best));
+    memset(ilc->e, 0, sizeof(ilc->e));
+    memset(ilc->hist, 0, sizeof(ilc->hist));
+    ilc->iter = 0;
+    ilc->worse = 0;
+    ilc->best_rms = INFINITY;
+    ilc->frozen = false;
+}
+
+// 영위상 1차 저역 통과: 정방향 후 역방향 (위상 지연 상쇄)
+static void q_filter(float *x, u32 n, float a) {
+    float y = x[0];
+    for (u32 k = 0; k < n; k++) { y += a * (x[k] - y); x[k] = y; }
+    y = x[n - 1];
+    for (u32 k = n; k-- > 0;) { y += a * (x[k] - y); x[k] = y; }
+}
+
+ilc_iter_t ilc_update(ilc_axis_t *ilc) {
+    const ilc_cfg_t *cfg = &ilc->cfg;
+    const u32 n = ilc->n;
+    ilc_iter_t it;
+
+    // 수렴 감시
+    double sq = 0.0;
+    s32 peak = 0;
+    for (u32 k = 0; k < n; k++) {
+        s32 e = ilc->e[k];
+        sq += (double)e * e;
+        if (e > peak) peak = e;
+        else if (-e > peak) peak = -e;
+    }
+    it.rms = (float)sqrt(sq / n);
+    it.peak = peak;
+    ilc->hist[ilc->iter % ILC_HIST] = it;
+    ilc->iter++;
+
+    if (it.rms < ilc->best_rms) {
+        ilc->best_rms = it.rms;
+        ilc->worse = 0;
+        memcpy(ilc->u_best, ilc->u, n * sizeof(s32));
+    } else if (it.rms <= ilc->best_rms * cfg->diverge_ratio) {
+        ilc->worse = 0;             // 허용 범위 안으로 돌아오면 연속 횟수를 다시 센다
+    } else if (++ilc->worse >= ILC_DIVERGE_COUNT) {
+        ilc->frozen = true;
+        memcpy(ilc->u, ilc->u_best, n * sizeof(s32));
+    }
+    if (ilc->frozen) return it;
+
+    // u + L * e[n + lead] (끝은 마지막 샘플 오차로 채움)
+    const float scale = 1.0f / (1 << ILC_FRAC);
+    for (u32 k = 0; k < n; k++) {
+        s64 j = (s64)k + cfg->lead;
+        if (j < 0) j = 0;
+        if (j >= (s64)n) j = n - 1;
+        ilc->w[k] = ilc->u[k] * scale + cfg->gain * (float)ilc->e[j];
+    }
+
+    if (cfg->q_cutoff_hz > 0.0f && cfg->sample_hz > 0)
+        q_filter(ilc->w, n, 1.0f - expf(-6.2831853f * cfg->q_cutoff_hz / cfg->sample_hz));
+
+    const float lim = (float)cfg->max_corr;
+    for (u32 k = 0; k < n; k++) {
+        float v = ilc->w[k];
+        if (v > lim) v = lim;
+        else if (v < -lim) v = -lim;
+        ilc->u[k] = (s32)lrintf(v * (1 << ILC_FRAC));
+    }
+    return it;
+}
@@ -0,0 +1,73 @@
+// ilc.h: 반복 학습 제어 (ILC) — 반복 트라젝토리의 재현성 있는 추종 오차 제거
+//
+// 같은 트라젝토리 (정방향 → 복귀) 를 반복할 때 샘플 n 의 오차는 매 반복 거의 같다.
+// 반복 j 의 오차 e_j 를 기록해 두었다가 반복이 끝나면 보정 테이블을 갱신한다.
+//
+//   u_{j+1}[n] = Q( u_j[n] + L * e_j[n + lead] )
+//
+// Q 는 영위상 1차 저역 통과 (정방향 + 역방향), lead 는 명령 → 스냅샷 지연과 플랜트 지연 보상.
+// 다음 반복에서 setpoint 에 u[n] 을 더한다 (PL 에 별도 feedforward 입력이 없으므로 REG_DESIRED 로 가산).
+// 틱에서는 덧셈 한 번 (ilc_apply) 과 기록 한 번 (ilc_record) 만 하고, 갱신은 반복 사이에 수행한다.
+//
+// 반복마다 RMS / 최대 오차를 기록해 수렴을 감시하며, RMS 가 최저치 대비 diverge_ratio 배를
+// 연속으로 넘으면 학습을 멈추고 최저 RMS 를 낸 테이블로 되돌린다. ilc_reset() 으로 처음부터 다시 학습.
+
+#ifndef ILC_H
+#define ILC_H
+
+#include <stdbool.h>
+#include "xil_types.h"
+
+#define ILC_MAX_SAMPLES     16384   // 5 kHz 에서 약 3.2 s (정방향 + 복귀 각 1 s 포함)
+#define ILC_FRAC            8       // 보정 테이블 포맷: Q23.8 카운트
+#define ILC_HIST            16      // 수렴 이력 (반복 수)
+#define ILC_DIVERGE_COUNT   3       // 연속 악화 허용 횟수
+
+typedef struct {
+    float gain;                 // 학습 게인 L (0 < L <= 1)
+    s32 lead;                   // 오차 위상 앞당김 (샘플)
+    float q_cutoff_hz;          // Q-filter 차단 주파수 (0 = 필터 없음)
+    u32 sample_hz;              // 샘플 주기 (명령 주파수)
+    s32 max_corr;               // |u| 제한 (카운트)
+    float diverge_ratio;        // RMS 악화 판정 배율
+} ilc_cfg_t;
+
+typedef struct {
+    float rms;
+    s32 peak;
+} ilc_iter_t;
+
+typedef struct {
+    ilc_cfg_t cfg;
+    u32 n;                      // 반복 당 샘플 수
+    u32 iter;                   // 완료된 학습 반복 수
+    u32 worse;                  // 연속 악화 횟수
+    float best_rms;
+    bool frozen;                // 발산 감지로 학습 정지 (u = u_best)
+    ilc_iter_t hist[ILC_HIST];  // 최근 반복 (iter % ILC_HIST)
+
+    s32 u[ILC_MAX_SAMPLES];     // 보정 테이블 (Q23.8)
+    s32 u_best[ILC_MAX_SAMPLES];    // 최저 RMS 반복에 쓰인 테이블
+    s32 e[ILC_MAX_SAMPLES];     // 현재 반복 오차 기록
+    float w[ILC_MAX_SAMPLES];   // 갱신 작업 버퍼
+} ilc_axis_t;
+
+void ilc_cfg_default(ilc_cfg_t *cfg, u32 sample_hz);
+
+// n_samples 가 바뀌면 (다른 트라젝토리) 호출. 테이블/이력 초기화
+int ilc_init(ilc_axis_t *ilc, const ilc_cfg_t *cfg, u32 n_samples);
+void ilc_reset(ilc_axis_t *ilc);
+
+// 틱: 보정된 setpoint 와 오차 기록 (ref 는 보정 전 트라젝토리 값)
+static inline s32 ilc_apply(const ilc_axis_t *ilc, u32 n, s32 ref) {
+    return ref + ((ilc->u[n] + (1 << (ILC_FRAC - 1))) >> ILC_FRAC);
+}
+
+static inline void ilc_record(ilc_axis_t *ilc, u32 n, s32 ref, s32 actual) {
+    ilc->e[n] = ref - actual;
+}
+
+// 반복 종료: 수렴 감시 후 테이블 갱신. 이번 반복의 RMS / 최대 오차를 반환
+ilc_iter_t ilc_update(ilc_axis_t *ilc);
+
+#endif
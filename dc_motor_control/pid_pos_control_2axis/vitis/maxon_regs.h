@@ -0,0 +1,135 @@
+// maxon_regs.h: maxon_top AXI-lite 레지스터 맵 (축당 하나의 IP 인스턴스)
+
+#ifndef MAXON_REGS_H
+#define MAXON_REGS_H
+
+#include "xil_types.h"
+#include "xil_io.h"
+
+#define REG_KPKI       0x00     // [15:0] Kp, [31:16] Ki (Q7.8)
+#define REG_KD         0x04     // [15:0] Kd (Q7.8)
+#define REG_ACTUAL     0x08     // 실제 위치 (RO)
+#define REG_DESIRED    0x0C     // 목표 위치
+
+// biquad 캐스케이드 (biquad.h 참고)
+#define REG_BQ_SEL     0x10     // [3:0] 계수 (b0,b1,b2,a1,a2), [7:4] 단, [8] 체인
+#define REG_BQ_DATA    0x14     // 계수 Q4.28, 쓰기마다 BQ_SEL 자동 증가 (읽기는 현재 BQ_SEL 위치)
+#define REG_BQ_CTRL    0x18     // [15:0] 단 enable, [30] commit 시 상태 초기화, [31] commit (읽기: 대기 중)
+#define REG_BQ_STAT    0x1C     // [31] commit 대기, [17:2] 활성 enable, [1:0] 포화 (W1C)
+
+// 상태 스냅샷 페이지 (RO): 모든 값이 같은 제어 틱에서 래치됨.
+// DESIRED / ACTUAL / ERROR 는 그 틱의 입력 (ERROR = DESIRED - ACTUAL). CONTROL 은 같은 틱의 출력이지만
+// Q7.8 제어기 (Pid_pos.v) 는 파이프라인 때문에 5틱 전 DESIRED / ACTUAL 로 계산된 값이다 (2자유도 PID 는 같은 틱).
+// REG_SNAP_TS_LO 를 읽는 순간 나머지 워드가 고정되므로 반드시 TS_LO 부터 읽는다.
+#define REG_SNAP_TS_LO      0x20    // PL 타임스탬프 [31:0] (10 ns 단위)
+#define REG_SNAP_TS_HI      0x24    // PL 타임스탬프 [63:32]
+#define REG_SNAP_TICK       0x28    // 제어 틱 카운터
+#define REG_SNAP_DESIRED    0x2C
+#define REG_SNAP_ACTUAL     0x30
+#define REG_SNAP_ERROR      0x34
+#define REG_SNAP_CONTROL    0x38    // 부호 확장된 control_signal
+#define REG_SNAP_FLAGS      0x3C
+
+#define SNAP_FLAG_SAT       0x1     // 제어 신호 포화 (±4000)
+#define SNAP_FLAG_DIR1      0x2
+#define SNAP_FLAG_DIR2      0x4
+#define SNAP_FLAG_TRIP      0x8     // 안전 감시기 트립 (출력 차단 중)
+
+#define PL_TS_HZ            100000000ULL    // PL 타임스탬프 클럭 (100 MHz)
+
+// 외란 관측기 (dob.h 참고)
+#define REG_DOB_CTRL   0x40     // [0] 보상 enable, [1] 추정 초기화 (쓰기 펄스), [6:4] 속도 창 2^n 틱, [31:16] Q-filter alpha (Q0.16)
+#define REG_DOB_KJ     0x44     // alpha * J (Q16.16, 제어 단위 / (카운트/틱))
+#define REG_DOB_B      0x48     // B (Q16.16, 제어 단위 / (카운트/틱))
+#define REG_DOB_LIMIT  0x4C     // [15:0] |보상| 제한 (제어 단위)
+#define REG_DOB_EST    0x50     // 추정 외란 (RO, 부호 있음, 제어 단위)
+
+// 안전 감시기 (safety.h 참고)
+#define REG_SAFE_CTRL   0x54    // [4:0] 원인 enable, [8] 트립 시 제동, [30] 소프트웨어 트립, [31] 트립 해제 (펄스)
+#define REG_SAFE_FOLLOW 0x58    // 추종 오차 한계 (카운트)
+#define REG_SAFE_LIMITS 0x5C    // [15:0] 과속 한계 (카운트/제어 틱), [31:16] 연속 포화 틱 (0 = 끔)
+#define REG_SAFE_WD     0x60    // [30:0] 워치독 timeout (10 ns, 0 = 끔), 쓰기마다 kick. [31] = kick 전용
+#define REG_SAFE_STAT   0x64    // [31] 트립 상태, [13:8] 현재 원인, [5:0] 마지막 트립 원인 (RO)
+#define REG_SAFE_TS_LO  0x68    // 마지막 트립 PL 타임스탬프 [31:0] (RO)
+#define REG_SAFE_TS_HI  0x6C    // [63:32]
+
+// 엔코더 프런트엔드 (encoder.h 참고)
+#define REG_ENC_CTRL    0x70    // [7:0] 글리치 필터 깊이 (클럭, 0 = 최소 지연), [9:8] 0: x4, 1: x2, 2: x1, [31] 상태 클리어
+#define REG_ENC_INDEX   0x74    // [15:0] Index 간 카운트 (0 = 검사 안 함), [23:16] 허용 오차
+#define REG_ENC_STAT    0x78    // [2] Index 래치됨, [1] Index 간격 오류, [0] 무효 전이 (RO, 클리어 전까지 유지)
+#define REG_ENC_INVALID 0x7C    // 무효 전이 수 (RO)
+#define REG_ENC_POS_LO  0x80    // 64비트 위치 [31:0], 읽는 순간 POS_HI 고정
+#define REG_ENC_POS_HI  0x84
+#define REG_ENC_IDX_LO  0x88    // 마지막 Index 위치 [31:0], 읽는 순간 IDX_HI 고정
+#define REG_ENC_IDX_HI  0x8C
+
+// 2자유도 PID (pid2.h 참고). 게인 = [23:0] 가수 / 2^[28:24]
+#define REG_PID2_CTRL   0x90    // [0] 2자유도 제어기 선택, [1] I / D 필터 초기화 (쓰기 펄스), [31:16] D 필터 alpha (Q0.16, 0 = 끔)
+#define REG_PID2_KP     0x94
+#define REG_PID2_KI     0x98    // 제어 단위 / 카운트 / 틱
+#define REG_PID2_KD     0x9C    // 제어 단위 / (카운트/틱)
+#define REG_PID2_KT     0xA0    // back-calculation 추적 게인 (틱당 비율)
+#define REG_PID2_WEIGHT 0xA4    // [15:0] P 목표 가중치 b, [31:16] D 목표 가중치 c (Q1.15)
+#define REG_PID2_INTEG  0xA8    // I 상태 (RO, Q16.16 제어 단위)
+
+// 2축 윤곽 제어 (contour.h 참고). 설정은 축 0 (BASEADDR1) 레지스터만 contour_coupler 에 연결된다
+#define REG_CC_CTRL     0xAC    // [0] 보정 enable, [1] 상태 초기화 (쓰기 펄스), [6:4] 속도 필터 2^n 틱
+#define REG_CC_GAIN     0xB0    // Kc (제어 단위 / 카운트), [23:0] 가수 / 2^[28:24]
+#define REG_CC_LIMIT    0xB4    // [15:0] |보정| 제한 (제어 단위), [31:16] 방향 갱신 최소 속도 (Q8.8 카운트/틱)
+#define REG_CC_ERR      0xB8    // 윤곽 오차 (RO, Q24.8 카운트, 두 축 인스턴스 공통)
+#define REG_CC_PEAK     0xBC    // 초기화 이후 최대 |윤곽 오차| (RO, Q24.8)
+#define REG_CC_STAT     0xC0    // [16] 경로 방향 확보, [15:0] 이 축 보정 (RO, 부호 있음)
+
+typedef struct {
+    u64 ts;                     // 틱 래치 시각 (10 ns)
+    u32 tick;
+    s32 desired;
+    s32 actual;
+    s32 error;
+    s32 control;
+    u32 flags;
+} maxon_snapshot_t;
+
+// 스냅샷 페이지 전체 읽기 (한 틱의 일관된 샘플)
+static inline void maxon_read_snapshot(UINTPTR base, maxon_snapshot_t *s) {
+    u32 lo = Xil_In32(base + REG_SNAP_TS_LO);
+    u32 hi = Xil_In32(base + REG_SNAP_TS_HI);
+    s->ts      = ((u64)hi << 32) | lo;
+    s->tick    = Xil_In32(base + REG_SNAP_TICK);
+    s->desired = (s32)Xil_In32(base + REG_SNAP_DESIRED);
+    s->actual  = (s32)Xil_In32(base + REG_SNAP_ACTUAL);
+    s->error   = (s32)Xil_In32(base + REG_SNAP_ERROR);
+    s->control = (s32)Xil_In32(base + REG_SNAP_CONTROL);
+    s->flags   = Xil_In32(base + REG_SNAP_FLAGS);
+}
+
+// 64비트 PL 타임스탬프 (스냅샷 페이지도 이 시점으로 고정)
+static inline u64 maxon_read_ts(UINTPTR base) {
+    u32 lo = Xil_In32(base + REG_SNAP_TS_LO);
+    u32 hi = Xil_In32(base + REG_SNAP_TS_HI);
+    return ((u64)hi << 32) | lo;
+}
+
+// 로깅용 최소 읽기: 타임스탬프 하위 워드 + 목표/실제 위치 (3회).
+// TS_HI 는 읽지 않고 ts_ref (±21 s 이내의 64비트 시각, 보통 직전 샘플) 기준으로 확장한다. 시각을 쓰지 않으면 0
+static inline void maxon_read_snapshot_pos(UINTPTR base, maxon_snapshot_t *s, u64 ts_ref) {
+    u32 lo = Xil_In32(base + REG_SNAP_TS_LO);
+    s->ts      = ts_ref + (s64)(s32)(lo - (u32)ts_ref);
+    s->desired = (s32)Xil_In32(base + REG_SNAP_DESIRED);
+    s->actual  = (s32)Xil_In32(base + REG_SNAP_ACTUAL);
+}
+
+// 64비트 위치 / Index 위치 (LO 먼저 읽어야 한 시점의 값)
+static inline s64 maxon_read_position64(UINTPTR base) {
+    u32 lo = Xil_In32(base + REG_ENC_POS_LO);
+    u32 hi = Xil_In32(base + REG_ENC_POS_HI);
+    return (s64)(((u64)hi << 32) | lo);
+}
+
+static inline s64 maxon_read_index64(UINTPTR base) {
+    u32 lo = Xil_In32(base + REG_ENC_IDX_LO);
+    u32 hi = Xil_In32(base + REG_ENC_IDX_HI);
+    return (s64)(((u64)hi << 32) | lo);
+}
+
+#endif
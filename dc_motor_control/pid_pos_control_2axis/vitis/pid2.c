@@ -0,0 +1,96 @@
+// pid2.c: PL 2자유도 PID 설정
+
+#include <math.h>
+#include "xil_io.h"
+#include "maxon_regs.h"
+#include "pid2.h"
+
+void pid2_cfg_default(pid2_cfg_t *cfg) {
+    cfg->kp = 0.0f;
+    cfg->ki = 0.0f;
+    cfg->kd = 0.0f;
+    cfg->kt = -1.0f;
+    cfg->b = 1.0f;
+    cfg->c = 0.0f;
+    cfg->d_cutoff_hz = 1000.0f;
+}
+
+void pid2_cfg_from_q78(pid2_cfg_t *cfg, u32 kpki, u32 kd) {
+    cfg->kp = (float)(kpki & 0x7FFF) / 256.0f;
+    cfg->ki = (float)((kpki >> 16) & 0x7FFF) / 256.0f;
+    cfg->kd = (float)(kd & 0x7FFF) / 256.0f;
+}
+
+u32 pid2_gain_encode(float g) {
+    if (!(g > 0.0f)) return 0;
+    if (g >= (float)PID2_MANT_MAX) return PID2_MANT_MAX;
+
+    // 가수가 24비트에 들어가는 가장 큰 시프트 (분해능 최대)
+    int e = PID2_SHIFT_MAX;
+    while (e > 0 && ldexpf(g, e) > (float)PID2_MANT_MAX)
+        e--;
+    u32 m = (u32)lrintf(ldexpf(g, e));
+    if (m > PID2_MANT_MAX) {            // 반올림으로 넘친 경우
+        m = (u32)lrintf(ldexpf(g, --e));
+    }
+    return ((u32)e << 24) | m;
+}
+
+float pid2_gain_decode(u32 reg) {
+    return ldexpf((float)(reg & PID2_MANT_MAX), -(int)((reg >> 24) & 0x1F));
+}
+
+// Q1.15 가중치
+static u32 weight_q15(float w, int *err) {
+    if (w < 0.0f) { *err = -1; return 0; }
+    if (w > 65535.0f / 32768.0f) { *err = -1; return 0xFFFF; }
+    return (u32)lrintf(w * 32768.0f);
+}
+
+int pid2_configure(UINTPTR base, const pid2_cfg_t *cfg) {
+    int err = 0;
+    float kt = cfg->kt;
+
+    if (cfg->kp < 0.0f || cfg->ki < 0.0f || cfg->kd < 0.0f) err = -1;
+    if (kt < 0.0f) {
+        // 추적 시정수 Tt = sqrt(Ti * Td) (Td = 0 이면 Ti), 틱 단위
+        if (cfg->kd > 0.0f && cfg->ki > 0.0f) kt = sqrtf(cfg->ki / cfg->kd);
+        else if (cfg->kp > 0.0f) kt = cfg->ki / cfg->kp;
+        else kt = 1.0f;
+    }
+    if (kt > 1.0f) kt = 1.0f;
+
+    u32 wp = weight_q15(cfg->b, &err);
+    u32 wd = weight_q15(cfg->c, &err);
+
+    u32 alpha = 0;
+    if (cfg->d_cutoff_hz > 0.0f) {
+        float a = 1.0f - expf(-2.0f * (float)M_PI * cfg->d_cutoff_hz / PID2_FS_HZ);
+        alpha = (u32)lrintf(a * 65536.0f);
+        if (alpha > 0xFFFF) alpha = 0xFFFF;
+        if (alpha == 0) alpha = 1;      // 0 은 필터 없음
+    }
+
+    Xil_Out32(base + REG_PID2_KP, pid2_gain_encode(cfg->kp));
+    Xil_Out32(base + REG_PID2_KI, pid2_gain_encode(cfg->ki));
+    Xil_Out32(base + REG_PID2_KD, pid2_gain_encode(cfg->kd));
+    Xil_Out32(base + REG_PID2_KT, pid2_gain_encode(kt));
+    Xil_Out32(base + REG_PID2_WEIGHT, (wd << 16) | wp);
+
+    u32 ctrl = Xil_In32(base + REG_PID2_CTRL) & PID2_CTRL_SELECT;
+    Xil_Out32(base + REG_PID2_CTRL, (alpha << 16) | ctrl);
+    return err;
+}
+
+void pid2_select(UINTPTR base, bool enable) {
+    u32 ctrl = Xil_In32(base + REG_PID2_CTRL) & ~(PID2_CTRL_SELECT | PID2_CTRL_CLEAR);
+    Xil_Out32(base + REG_PID2_CTRL, ctrl | (enable ? PID2_CTRL_SELECT : 0));
+}
+
+void pid2_clear(UINTPTR base) {
+    Xil_Out32(base + REG_PID2_CTRL, Xil_In32(base + REG_PID2_CTRL) | PID2_CTRL_CLEAR);
+}
+
+float pid2_read_integ(UINTPTR base) {
+    return (float)(s32)Xil_In32(base + REG_PID2_INTEG) / 65536.0f;
+}
@@ -0,0 +1,56 @@
+// pid2.h: PL 2자유도 PID (pid_2dof_controller, Pid_pos_2dof.v) 설정
+//
+// 게인은 Pid_pos.v 와 같은 단위 (제어 단위 / 카운트, 틱 기준) 의 float 로 받아 24비트 가수 + 시프트로 바꾼다.
+// 상대 분해능은 항상 2^-23 이므로 Q7.8 에서 0 이 되던 작은 Ki (예: 0.0005) 도 그대로 표현된다.
+//
+//   pid2_cfg_t c;
+//   pid2_cfg_default(&c);
+//   c.kp = 2.0f; c.ki = 0.0005f; c.kd = 20.0f;
+//   pid2_configure(BASEADDR1, &c);
+//   pid2_select(BASEADDR1, true);          // 비선택 중에도 I 가 기존 출력을 따라가므로 전환 시 점프가 작다
+//
+// b = 1, c = 0 (기본) 이면 P 는 오차, D 는 측정값 미분 → 목표 스텝에서 D 킥이 없다.
+
+#ifndef PID2_H
+#define PID2_H
+
+#include <stdbool.h>
+#include "xil_types.h"
+#include "maxon_regs.h"
+
+#define PID2_FS_HZ          20000.0f    // 제어 주기
+#define PID2_MANT_MAX       0xFFFFFFU
+#define PID2_SHIFT_MAX      31
+
+#define PID2_CTRL_SELECT    0x1U
+#define PID2_CTRL_CLEAR     0x2U
+
+typedef struct {
+    float kp;                   // 제어 단위 / 카운트
+    float ki;                   // 제어 단위 / 카운트 / 틱
+    float kd;                   // 제어 단위 / (카운트/틱)
+    float kt;                   // 추적 게인 (틱당, 0 ~ 1), 음수 = 자동 (sqrt(Ki/Kd), Kd = 0 이면 Ki/Kp)
+    float b;                    // P 목표 가중치 (0 ~ 1.99)
+    float c;                    // D 목표 가중치
+    float d_cutoff_hz;          // D 저역 통과 차단 주파수 (0 = 필터 없음)
+} pid2_cfg_t;
+
+void pid2_cfg_default(pid2_cfg_t *cfg);
+
+// Q7.8 게인 레지스터 (REG_KPKI / REG_KD) 값 → 같은 동작의 설정 (가중치 / 필터는 유지)
+void pid2_cfg_from_q78(pid2_cfg_t *cfg, u32 kpki, u32 kd);
+
+// float ↔ 게인 레지스터. 음수는 0, 범위 초과는 최대값으로 제한
+u32 pid2_gain_encode(float g);
+float pid2_gain_decode(u32 reg);
+
+// 게인 / 가중치 / 필터 기록 (선택 상태는 유지). 범위를 벗어난 값이 있으면 -1 (제한해서 기록)
+int pid2_configure(UINTPTR base, const pid2_cfg_t *cfg);
+
+void pid2_select(UINTPTR base, bool enable);
+void pid2_clear(UINTPTR base);
+
+// I 상태 (제어 단위)
+float pid2_read_integ(UINTPTR base);
+
+#endif
@@ -0,0 +1,107 @@
+// plant_sim.c: PL 위치 제어기 + DC 모터 시뮬레이션
+
+#include <string.h>
+#include "plant_sim.h"
+
+#define INTEGRAL_LIMIT  2000000000
+#define PLANT_SUBSTEPS  4       // 틱당 모터 적분 횟수 (전기 시정수 대비 충분히 작게)
+
+void plant_param_default(plant_param_t *prm) {
+    // maxon DC 모터 + 512 CPR 엔코더 (x4) 기준 대략값
+    prm->supply_v = 24.0f;
+    prm->r_ohm = 2.0f;
+    prm->l_h = 0.2e-3f;
+    prm->kt = 0.03f;
+    prm->j = 2.0e-5f;
+    prm->b = 2.0e-6f;
+    prm->tc = 2.0e-3f;
+    prm->counts_per_rad = 2048.0f / 6.2831853f;
+}
+
+// 48비트 레지스터 래핑
+static inline s64 sext48(s64 v) {
+    return (s64)((u64)v << 16) >> 16;
+}
+
+void pid_pos_model_reset(pid_pos_model_t *m) {
+    u16 kp = m->kp, ki = m->ki, kd = m->kd;
+    memset(m, 0, sizeof(*m));
+    m->kp = kp; m->ki = ki; m->kd = kd;
+}
+
+void pid_pos_model_tick(pid_pos_model_t *m, s32 desired, s32 actual) {
+    // 모든 우변은 이전 틱 값 (논블로킹 대입과 동일)
+    const pid_pos_model_t o = *m;
+
+    m->actual_ff = actual;
+    m->desired_ff = desired;
+    m->error = (s32)((u32)o.desired_ff - (u32)o.actual_ff);
+    m->prev_error = o.error;
+    m->delta_error = (s32)((u32)o.error - (u32)o.prev_error);
+
+    // 적분: 포화 시 정지, (RTL 그대로) 오차를 입력 desired_pos 와 비교해 감쇠, 그 외 누적
+    s32 d_hi = (s32)((u32)desired + 2), d_lo = (s32)((u32)desired - 2);
+    if (o.control >= 3950 || o.control <= -3950) {
+        m->integral = o.integral;
+    } else if (o.error < d_hi && o.error > d_lo) {
+        m->integral = o.integral - (o.integral >> 6);
+    } else {
+        s32 acc = (s32)((u32)o.integral + (u32)o.error);    // 32비트 덧셈 (래핑)
+        if (acc > INTEGRAL_LIMIT) m->integral = INTEGRAL_LIMIT;
+        else if (acc < -INTEGRAL_LIMIT) m->integral = -INTEGRAL_LIMIT;
+        else m->integral = acc;
+    }
+
+    m->p = (s64)(s16)o.kp * o.error;
+    m->i = (s64)(s16)o.ki * o.integral;
+    m->d = (s64)(s16)o.kd * o.delta_error;
+    m->sum = sext48(o.p + o.i + o.d);
+    m->mid = o.sum >> 8;
+
+    if (o.mid > PLANT_SIM_CTRL_MAX) m->control = PLANT_SIM_CTRL_MAX;
+    else if (o.mid < -PLANT_SIM_CTRL_MAX) m->control = -PLANT_SIM_CTRL_MAX;
+    else m->control = (s16)o.mid;
+}
+
+void plant_sim_init(plant_sim_t *s, const plant_param_t *prm) {
+    memset(s, 0, sizeof(*s));
+    s->prm = *prm;
+}
+
+void plant_sim_set_gains(plant_sim_t *s, u32 kpki, u32 kd) {
+    s->pid.kp = (u16)(kpki & 0xFFFF);
+    s->pid.ki = (u16)(kpki >> 16);
+    s->pid.kd = (u16)(kd & 0xFFFF);
+}
+
+static void motor_step(plant_sim_t *s, float v, float h) {
+    const plant_param_t *p = &s->prm;
+
+    s->cur += h * (v - p->r_ohm * s->cur - p->kt * s->omega) / p->l_h;
+
+    float torque = p->kt * s->cur - p->b * s->omega;
+    if (s->omega > 1e-3f) torque -= p->tc;
+    else if (s->omega < -1e-3f) torque += p->tc;
+    else if (torque > p->tc) torque -= p->tc;          // 정지 마찰 (stiction)
+    else if (torque < -p->tc) torque += p->tc;
+    else { torque = 0.0f; s->omega = 0.0f; }
+
+    s->omega += h * torque / p->j;
+    s->theta += h * s->omega;
+}
+
+void plant_sim_run(plant_sim_t *s, u32 n_ticks) {
+    const float h = 1.0f / (PLANT_SIM_TICK_HZ * PLANT_SUBSTEPS);
+
+    for (u32 t = 0; t < n_ticks; t++) {
+        pid_pos_model_tick(&s->pid, s->desired, s->encoder);
+
+        float v = s->prm.supply_v * (float)s->pid.control / PLANT_SIM_CTRL_MAX;
+        for (int k = 0; k < PLANT_SUBSTEPS; k++)
+            motor_step(s, v, h);
+
+        float c = s->theta * s->prm.counts_per_rad;
+        s->encoder = (s32)(c < 0.0f ? c - 0.5f : c + 0.5f);
+        s->ticks++;
+    }
+}
@@ -0,0 +1,59 @@
+// plant_sim.h: PL 위치 제어기 + DC 모터 시뮬레이션 (게인 스윕 / 오프라인 검증용)
+//
+// 제어기는 Pid_pos.v (pi_velocity_controller) 의 20 kHz 틱 파이프라인을 고정소수점으로
+// 그대로 따른다 (P/I/D 곱 → 합 → >>>8 → 포화가 틱마다 한 단계씩 진행).
+// 모터는 PWM 평균 전압을 입력으로 하는 1차 전기 + 관성/점성 마찰 모델이며,
+// 위치는 엔코더 카운트로 양자화된다.
+
+#ifndef PLANT_SIM_H
+#define PLANT_SIM_H
+
+#include "xil_types.h"
+
+#define PLANT_SIM_TICK_HZ   20000       // Pid_pos.v DIVIDER = 5000 @ 100 MHz
+#define PLANT_SIM_CTRL_MAX  4000        // PWM MAX_COUNT
+
+// 모터/부하 파라미터 (SI 단위)
+typedef struct {
+    float supply_v;             // 브리지 전원 전압
+    float r_ohm;                // 권선 저항
+    float l_h;                  // 권선 인덕턴스
+    float kt;                   // 토크 상수 (Nm/A) = 역기전력 상수 (V·s/rad)
+    float j;                    // 회전자 + 부하 관성 (kg·m²)
+    float b;                    // 점성 마찰 (Nm·s/rad)
+    float tc;                   // 쿨롱 마찰 (Nm)
+    float counts_per_rad;       // 엔코더 x4 카운트 / rad
+} plant_param_t;
+
+// pi_velocity_controller 레지스터 상태
+typedef struct {
+    s32 desired_ff, actual_ff;
+    s32 error, prev_error, delta_error;
+    s32 integral;
+    s64 p, i, d;                // 48비트
+    s64 sum;                    // pid_output (48비트)
+    s64 mid;                    // pid_output_mid (41비트)
+    s16 control;
+    u16 kp, ki, kd;             // Q7.8
+} pid_pos_model_t;
+
+typedef struct {
+    plant_param_t prm;
+    pid_pos_model_t pid;
+    s32 desired;                // REG_DESIRED
+    float theta, omega, cur;    // 위치 (rad), 속도 (rad/s), 전류 (A)
+    s32 encoder;                // 양자화된 위치
+    u64 ticks;
+} plant_sim_t;
+
+void plant_param_default(plant_param_t *prm);
+
+// 제어기 한 틱 (clk_20k_enable 사이클과 동일한 레지스터 갱신)
+void pid_pos_model_reset(pid_pos_model_t *m);
+void pid_pos_model_tick(pid_pos_model_t *m, s32 desired, s32 actual);
+
+void plant_sim_init(plant_sim_t *s, const plant_param_t *prm);
+void plant_sim_set_gains(plant_sim_t *s, u32 kpki, u32 kd);    // REG_KPKI / REG_KD 와 같은 포맷
+void plant_sim_run(plant_sim_t *s, u32 n_ticks);
+
+#endif
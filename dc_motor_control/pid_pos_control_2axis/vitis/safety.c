@@ -0,0 +1,71 @@
+// safety.c: PL 안전 감시기 설정 및 트립 처리
+
+#include <stdio.h>
+#include <string.h>
+#include "safety.h"
+#include "encoder.h"
+#include "dob.h"
+#include "pid2.h"
+
+void safety_cfg_default(safety_cfg_t *cfg) {
+    cfg->mask = SAFE_FAULT_FOLLOW | SAFE_FAULT_SPEED | SAFE_FAULT_SAT | SAFE_FAULT_ENCODER;
+    cfg->brake = true;
+    cfg->follow_limit = 5000;           // 약 2.4 회전 (2048 카운트/rev)
+    cfg->speed_limit = 20;              // 400k 카운트/s (무부하 최고 속도 약 1.5배)
+    cfg->sat_ticks = 20000;             // 1 s 연속 포화
+    cfg->wd_timeout_us = 0;
+}
+
+void safety_configure(UINTPTR base, const safety_cfg_t *cfg) {
+    u32 sat = cfg->sat_ticks > 0xFFFF ? 0xFFFF : cfg->sat_ticks;
+    u32 spd = cfg->speed_limit > 0xFFFF ? 0xFFFF : cfg->speed_limit;
+    u64 wd = (u64)cfg->wd_timeout_us * (PL_TS_HZ / 1000000);
+    if (wd > 0x7FFFFFFF) wd = 0x7FFFFFFF;
+
+    Xil_Out32(base + REG_SAFE_FOLLOW, cfg->follow_limit);
+    Xil_Out32(base + REG_SAFE_LIMITS, (sat << 16) | spd);
+    Xil_Out32(base + REG_SAFE_WD, (u32)wd);
+    Xil_Out32(base + REG_SAFE_CTRL, (cfg->mask & 0x1F) | (cfg->brake ? SAFE_CTRL_BRAKE : 0));
+}
+
+void safety_read(UINTPTR base, safety_status_t *st) {
+    u32 s = Xil_In32(base + REG_SAFE_STAT);
+    st->tripped = (s & SAFE_STAT_TRIPPED) != 0;
+    st->fault = s & 0x3F;
+    st->live = (s >> 8) & 0x3F;
+    // 트립 시각은 다음 트립까지 고정이므로 두 번 읽어도 일관됨
+    u32 lo = Xil_In32(base + REG_SAFE_TS_LO);
+    u32 hi = Xil_In32(base + REG_SAFE_TS_HI);
+    st->trip_ts = ((u64)hi << 32) | lo;
+}
+
+int safety_clear(UINTPTR base, u32 *enc_stat) {
+    u32 ctrl = Xil_In32(base + REG_SAFE_CTRL) & 0x1FF;
+    // 엔코더 오류는 엔코더 쪽에 래치되므로 같이 클리어 (클리어 전 상태를 돌려줌)
+    u32 es = Xil_In32(base + REG_ENC_STAT) & (ENC_STAT_INVALID | ENC_STAT_INDEX_ERR);
+    if (enc_stat) *enc_stat = es;
+    if (es) enc_clear(base);
+    // 트립 전 추정 / 적분 상태로 재기동하지 않도록 초기화 (다음 틱에 적용)
+    dob_clear(base);
+    pid2_clear(base);
+    Xil_Out32(base + REG_DESIRED, Xil_In32(base + REG_ACTUAL));
+    Xil_Out32(base + REG_SAFE_CTRL, ctrl | SAFE_CTRL_CLEAR);
+    return (Xil_In32(base + REG_SAFE_STAT) & SAFE_STAT_TRIPPED) ? -1 : 0;
+}
+
+void safety_trip(UINTPTR base) {
+    u32 ctrl = Xil_In32(base + REG_SAFE_CTRL) & 0x1FF;
+    Xil_Out32(base + REG_SAFE_CTRL, ctrl | SAFE_CTRL_TRIP);
+}
+
+const char *safety_fault_str(u32 fault, char *buf, int len) {
+    static const char *names[] = { "FOLLOW", "SPEED", "SAT", "ENCODER", "WDOG", "SW" };
+    int n = 0;
+    buf[0] = '\0';
+    for (int i = 0; i < 6 && n < len; i++) {
+        if (!(fault & (1U << i))) continue;
+        n += snprintf(buf + n, len - n, "%s%s", n ? "|" : "", names[i]);
+    }
+    if (n == 0) snprintf(buf, len, "-");
+    return buf;
+}
@@ -0,0 +1,66 @@
+// safety.h: PL 안전 감시기 (safety_supervisor.v) 설정 및 트립 처리
+//
+// 트립 판정은 모두 PL 에서 클럭 단위로 이뤄지고, 여기서는 한계값 설정 / 상태 확인 / 해제만 한다.
+// 워치독을 켜면 PS 는 timeout 안에 safety_kick() 을 계속 불러야 한다 (제어 루프마다 1회면 충분).
+// 메뉴 입력 대기처럼 루프가 멈추는 구간에서도 트립되므로, 단일 코어 프로그램에서는
+// 워치독을 끄거나 (timeout 0) CPU1 실시간 루프 (amp_core1_rt.c) 처럼 항상 도는 곳에서 kick 한다.
+//
+// 트립 중 PL 은 DOB 추정을 유지하고 (u = 0 으로 간주) PID 적분 / 2-DOF 출력을 0 으로 둔다.
+// 해제는 safety_clear(): 래치된 엔코더 오류 클리어, DOB / 2-DOF 상태 초기화, 목표 위치를 현재 위치로
+// 맞춘 뒤 clear 펄스. 원인이 남아 있으면 즉시 재트립.
+
+#ifndef SAFETY_H
+#define SAFETY_H
+
+#include <stdbool.h>
+#include "xil_types.h"
+#include "xil_io.h"
+#include "maxon_regs.h"
+
+// 원인 비트 (REG_SAFE_CTRL enable / REG_SAFE_STAT)
+#define SAFE_FAULT_FOLLOW   0x01
+#define SAFE_FAULT_SPEED    0x02
+#define SAFE_FAULT_SAT      0x04
+#define SAFE_FAULT_ENCODER  0x08
+#define SAFE_FAULT_WDOG     0x10
+#define SAFE_FAULT_SW       0x20        // 소프트웨어 트립 (항상 활성)
+
+#define SAFE_CTRL_BRAKE     0x100U
+#define SAFE_CTRL_TRIP      0x40000000U
+#define SAFE_CTRL_CLEAR     0x80000000U
+#define SAFE_WD_KICK_ONLY   0x80000000U
+#define SAFE_STAT_TRIPPED   0x80000000U
+
+typedef struct {
+    u32 mask;                   // SAFE_FAULT_* (SW 제외)
+    bool brake;                 // 트립 시 제동 (false = 코스트)
+    u32 follow_limit;           // 카운트
+    u32 speed_limit;            // 카운트 / 제어 틱 (20 kHz)
+    u32 sat_ticks;              // 연속 포화 허용 틱 (0 = 끔)
+    u32 wd_timeout_us;          // 0 = 워치독 끔
+} safety_cfg_t;
+
+typedef struct {
+    bool tripped;
+    u32 fault;                  // 마지막 트립 원인
+    u32 live;                   // 현재 원인 (enable 무관)
+    u64 trip_ts;                // 마지막 트립 시각 (10 ns)
+} safety_status_t;
+
+void safety_cfg_default(safety_cfg_t *cfg);
+void safety_configure(UINTPTR base, const safety_cfg_t *cfg);
+void safety_read(UINTPTR base, safety_status_t *st);
+
+// 엔코더 오류 / DOB / 2-DOF 상태 클리어 + 목표 = 현재 위치로 맞춘 뒤 해제. 해제 후에도 트립 상태면 -1
+// enc_stat (NULL 가능): 클리어 전 엔코더 오류 비트 (ENC_STAT_INVALID / ENC_STAT_INDEX_ERR)
+int safety_clear(UINTPTR base, u32 *enc_stat);
+void safety_trip(UINTPTR base);
+
+static inline void safety_kick(UINTPTR base) {
+    Xil_Out32(base + REG_SAFE_WD, SAFE_WD_KICK_ONLY);
+}
+
+// 원인 비트 → "FOLLOW|SAT" 형태 문자열
+const char *safety_fault_str(u32 fault, char *buf, int len);
+
+#endif
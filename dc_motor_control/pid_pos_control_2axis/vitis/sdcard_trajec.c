@@ -8,18 +8,27 @@
 #include "xil_io.h"
 #include "ff.h"
 #include "xtime_l.h"
+#include "trajectory.h"
+#include "tlm_dma.h"
+#include "maxon_regs.h"
+#include "gain_sweep.h"
+#include "plant_sim.h"
+#include "ilc.h"
+#include "biquad.h"
+#include "dob.h"
+#include "safety.h"
+#include "encoder.h"
+#include "pid2.h"
+#include "contour.h"
 
 #define BASEADDR1      XPAR_MAXON_TOP_0_BASEADDR
 #define BASEADDR2      XPAR_MAXON_TOP_1_BASEADDR
-#define REG_KPKI       0x00
-#define REG_KD         0x04
-#define REG_ACTUAL     0x08
-#define REG_DESIRED    0x0C
-#define COUNTS_PER_MS  (XPAR_CPU_CORTEXA9_0_CPU_CLK_FREQ_HZ / 1000)
 
 // 트라젝틱 주파수 (Hz)
 #define CMD_FREQ_HZ    5000
-#define COUNTS_PER_CMD (XPAR_CPU_CORTEXA9_0_CPU_CLK_FREQ_HZ / CMD_FREQ_HZ)
+// XTime 은 CPU 클럭 / 2 로 증가 → 명령 주기를 COUNTS_PER_SECOND 기준으로 계산
+#define XTIME_PER_CMD  (COUNTS_PER_SECOND / CMD_FREQ_HZ)
+#define NUM_AXES       2
 
 FATFS fs;
 FIL fil;
@@ -27,7 +36,33 @@ bool log_enabled = true;
 bool log_header_written = false;
 char log_filename[12];  // "LOGxx.CSV"
 int log_file_counter = 1;
-XTime t_start, t_prev;
+int cap_file_counter = 1;
+int sweep_file_counter = 1;
+bool tlm_dma_ok = false;
+u64 pl_ts_start, pl_ts_prev;     // PL 타임스탬프 (10 ns)
+u64 pl_ts_ref;                   // maxon_read_snapshot_pos 확장 기준 (로깅 루프 시작 시 갱신)
+traj_profile_t traj;
+
+// ILC: 반복 트라젝토리 보정 테이블 (계획이 바뀌면 초기화)
+static ilc_axis_t ilc_axis[NUM_AXES];
+ilc_cfg_t ilc_cfg;
+bool ilc_valid = false;
+s32 ilc_q0[NUM_AXES], ilc_qf[NUM_AXES];
+
+// 외란 관측기 설정 (두 축 공통)
+dob_cfg_t dob_cfg;
+
+// 안전 감시기 한계 (두 축 공통). 이 프로그램은 메뉴에서 멈추므로 워치독은 기본 끔
+safety_cfg_t safety_cfg;
+
+// 엔코더 프런트엔드 설정 (두 축 공통)
+enc_cfg_t enc_cfg;
+
+// 2자유도 PID 설정 (두 축 공통)
+pid2_cfg_t pid2_cfg;
+
+// 윤곽 제어 설정 (축 0 레지스터)
+cc_cfg_t cc_cfg;
 
 void flush_stdin() {
     int c;
@@ -44,14 +79,113 @@ float q78_to_float(int qval) {
     return (qval & 0x7FFF) / 256.0f;
 }
 
-int quintic_trajectory(u32 t_ms, u32 T_ms, int q0, int qf) {
-    float tau = (float)t_ms / (float)T_ms;
-    if (tau < 0.0f) tau = 0.0f;
-    if (tau > 1.0f) tau = 1.0f;
-    float q = 6*tau*tau*tau*tau*tau
-            - 15*tau*tau*tau*tau
-            + 10*tau*tau*tau;
-    return q0 + (int)((qf - q0) * q);
+// 한 샘플 로그 (LOGxx.CSV): 두 축 스냅샷의 목표/실제 위치와 PL 타임스탬프 기준 시간
+void log_sample(const maxon_snapshot_t *s1, const maxon_snapshot_t *s2, float kp_f, float ki_f, float kd_f) {
+    char buf[128];
+    UINT bw;
+
+    u64 sys = (s1->ts - pl_ts_start) / (PL_TS_HZ / 1000000);    // us
+    u64 del = (s1->ts - pl_ts_prev) / (PL_TS_HZ / 1000000);
+    pl_ts_prev = s1->ts;
+
+    if (!log_enabled) return;
+    if (!log_header_written) {
+        strcpy(buf, "Time_ms,Delta_ms,Kp,Ki,Kd,Des1,Act1,Err1,Des2,Act2,Err2\n");
+        f_write(&fil, buf, strlen(buf), &bw);
+        log_header_written = true;
+    }
+    int len = snprintf(buf, sizeof(buf), "%llu.%03lu,%llu.%03lu,%.3f,%.3f,%.3f,%d,%d,%d,%d,%d,%d\n",
+                       sys / 1000, (u32)(sys % 1000), del / 1000, (u32)(del % 1000), kp_f, ki_f, kd_f,
+                       (int)s1->desired, (int)s1->actual, (int)(s1->desired - s1->actual),
+                       (int)s2->desired, (int)s2->actual, (int)(s2->desired - s2->actual));
+    f_write(&fil, buf, len, &bw);
+}
+
+// ---- 게인 스윕 백엔드: 실기 (REG_*) ----
+static const UINTPTR sweep_base[NUM_AXES] = { BASEADDR1, BASEADDR2 };
+static XTime sweep_t_cmd;
+
+static void hw_set_gains(void *ctx, int axis, u32 kpki, u32 kd) {
+    (void)ctx;
+    Xil_Out32(sweep_base[axis] + REG_KPKI, kpki);
+    Xil_Out32(sweep_base[axis] + REG_KD,   kd);
+}
+
+static void hw_set_desired(void *ctx, int axis, s32 pos) {
+    (void)ctx;
+    Xil_Out32(sweep_base[axis] + REG_DESIRED, pos);
+}
+
+static void hw_read(void *ctx, int axis, s32 *desired, s32 *actual) {
+    (void)ctx;
+    maxon_snapshot_t s;
+    maxon_read_snapshot_pos(sweep_base[axis], &s, 0);
+    *desired = s.desired;
+    *actual = s.actual;
+}
+
+static void hw_wait_cmd(void *ctx) {
+    (void)ctx;
+    XTime now;
+    do {
+        XTime_GetTime(&now);
+    } while ((now - sweep_t_cmd) < (XTime)XTIME_PER_CMD);
+    sweep_t_cmd += XTIME_PER_CMD;
+    if (now - sweep_t_cmd > (XTime)XTIME_PER_CMD) sweep_t_cmd = now;    // 긴 정지 후 몰아치기 방지
+}
+
+// ---- 게인 스윕 백엔드: 시뮬레이션 (plant_sim) ----
+static plant_sim_t sweep_sim[NUM_AXES];
+
+static void sim_set_gains(void *ctx, int axis, u32 kpki, u32 kd) {
+    (void)ctx;
+    plant_sim_set_gains(&sweep_sim[axis], kpki, kd);
+}
+
+static void sim_set_desired(void *ctx, int axis, s32 pos) {
+    (void)ctx;
+    sweep_sim[axis].desired = pos;
+}
+
+static void sim_read(void *ctx, int axis, s32 *desired, s32 *actual) {
+    (void)ctx;
+    *desired = sweep_sim[axis].pid.desired_ff;
+    *actual = sweep_sim[axis].pid.actual_ff;
+}
+
+static void sim_wait_cmd(void *ctx) {
+    (void)ctx;
+    for (int i = 0; i < NUM_AXES; i++)
+        plant_sim_run(&sweep_sim[i], PLANT_SIM_TICK_HZ / CMD_FREQ_HZ);
+}
+
+// ---- 게인 스윕 파일 출력 (FatFs) ----
+static FIL sweep_fil[SWEEP_NUM_FILES];
+
+static int sweep_open(void *ctx, int slot, const char *name) {
+    (void)ctx;
+    return f_open(&sweep_fil[slot], name, FA_CREATE_ALWAYS | FA_WRITE) == FR_OK ? 0 : -1;
+}
+
+static void sweep_write(void *ctx, int slot, const char *buf, int len) {
+    (void)ctx;
+    UINT bw;
+    f_write(&sweep_fil[slot], buf, len, &bw);
+}
+
+static void sweep_close(void *ctx, int slot) {
+    (void)ctx;
+    f_close(&sweep_fil[slot]);
+}
+
+static bool read_gain_range(const char *name, float *lo, float *hi, u32 *steps) {
+    printf("%s range (lo hi steps): ", name);
+    if (scanf("%f %f %lu", lo, hi, steps) != 3 || *lo < 0.0f || *hi > 127.996f || *lo > *hi || *steps == 0) {
+        printf("[X] Invalid range.\n");
+        flush_stdin();
+        return false;
+    }
+    return true;
 }
 
 int main() {
@@ -77,8 +211,22 @@ int main() {
         printf("[ERR] initial f_open failed: %d\n", res);
     }
 
-    XTime_GetTime(&t_start);
-    t_prev = t_start;
+    // DMA 텔레메트리 경로 초기화 (비트스트림에 없으면 mode 6 비활성)
+    tlm_dma_ok = (tlm_dma_init() == XST_SUCCESS);
+    if (!tlm_dma_ok) printf("[WARN] DMA telemetry not available.\n");
+
+    ilc_cfg_default(&ilc_cfg, CMD_FREQ_HZ);
+    dob_cfg_default(&dob_cfg);
+    safety_cfg_default(&safety_cfg);
+    enc_cfg_default(&enc_cfg);
+    pid2_cfg_default(&pid2_cfg);
+    cc_cfg_default(&cc_cfg);
+
+    // PL 리셋 값은 한계 0 (감시 해제) 이므로 부팅 직후 기본 한계로 무장 (워치독은 기본값대로 끔)
+    safety_configure(BASEADDR1, &safety_cfg);
+    safety_configure(BASEADDR2, &safety_cfg);
+
+    pl_ts_start = pl_ts_prev = maxon_read_ts(BASEADDR1);
 
     while (1) {
         printf("\n======= 2-Axis Control Menu =======\n");
@@ -87,11 +235,20 @@ int main() {
         printf("3. Read All Status\n");
         printf("4. Reset All\n");
         printf("5. Toggle SD Logging (currently: %s)\n", log_enabled ? "ON" : "OFF");
+        printf("6. DMA Telemetry Capture (binary)\n");
+        printf("7. Gain Sweep (hardware / simulation)\n");
+        printf("8. ILC Repeated Trajectory (Forward & Return)\n");
+        printf("9. Biquad Filters (notch / low-pass)\n");
+        printf("10. Disturbance Observer\n");
+        printf("11. Safety Supervisor\n");
+        printf("12. Encoder (filter / decode / index)\n");
+        printf("13. 2-DOF PID (setpoint weighting / filtered D / anti-windup)\n");
+        printf("14. Cross-Coupled Contouring\n");
 
         bool valid = false;
         while (!valid) {
-            printf("Select mode (1-5): ");
-            if (scanf("%d", &mode) == 1 && mode >= 1 && mode <= 5) valid = true;
+            printf("Select mode (1-14): ");
+            if (scanf("%d", &mode) == 1 && mode >= 1 && mode <= 14) valid = true;
             else { printf("[X] Invalid input.\n"); flush_stdin(); }
         }
 
@@ -128,82 +285,95 @@ int main() {
             printf("Enter target pos Axis1: "); scanf("%d", &target_pos1);
             printf("Enter target pos Axis2: "); scanf("%d", &target_pos2);
 
-            int q0_1 = Xil_In32(BASEADDR1 + REG_ACTUAL);
-            int q0_2 = Xil_In32(BASEADDR2 + REG_ACTUAL);
-
-            XTime t_phase, t_cmd;
-            XTime_GetTime(&t_phase);
-            t_cmd = t_phase;
+            s32 q0[NUM_AXES], qf[NUM_AXES] = { target_pos1, target_pos2 };
+            q0[0] = (s32)Xil_In32(BASEADDR1 + REG_ACTUAL);
+            q0[1] = (s32)Xil_In32(BASEADDR2 + REG_ACTUAL);
 
+            // 정방향 → 복귀 두 구간을 미리 계산해 두고 틱마다 한 번에 두 축 평가
             u32 phase_ms = 1000;
-            u32 total_ms = 2 * phase_ms;
-            XTime interval = (XTime)COUNTS_PER_CMD;
+            u32 phase_n = phase_ms * (CMD_FREQ_HZ / 1000);
+            traj_profile_init(&traj, NUM_AXES, true);
+            traj_profile_add(&traj, phase_n, q0, qf);
+            traj_profile_add(&traj, phase_n, qf, q0);
 
-            char buf[128];
-            UINT bw;
+            XTime t_cmd;
+            XTime_GetTime(&t_cmd);
+            XTime interval = (XTime)XTIME_PER_CMD;
+
+            s32 des[TRAJ_MAX_AXES];
+            pl_ts_ref = maxon_read_ts(BASEADDR1);
 
             while (1) {
                 XTime now;
                 XTime_GetTime(&now);
-                u32 elapsed = (u32)((now - t_phase) / COUNTS_PER_MS);
-                if (elapsed > total_ms) break;
 
                 if ((now - t_cmd) >= interval) {
-                    int des1 = (elapsed <= phase_ms)
-                             ? quintic_trajectory(elapsed, phase_ms, q0_1, target_pos1)
-                             : quintic_trajectory(elapsed - phase_ms, phase_ms, target_pos1, q0_1);
-                    int des2 = (elapsed <= phase_ms)
-                             ? quintic_trajectory(elapsed, phase_ms, q0_2, target_pos2)
-                             : quintic_trajectory(elapsed - phase_ms, phase_ms, target_pos2, q0_2);
+                    if (!traj_profile_step(&traj, des)) break;
+                    int des1 = des[0];
+                    int des2 = des[1];
 
 					Xil_Out32(BASEADDR1 + REG_DESIRED, des1);
 					Xil_Out32(BASEADDR2 + REG_DESIRED, des2);
 
-                    int act1 = Xil_In32(BASEADDR1 + REG_ACTUAL);
-                    int act2 = Xil_In32(BASEADDR2 + REG_ACTUAL);
-
-                    u32 sys = (u32)((now - t_start) / COUNTS_PER_MS);
-                    u32 del = (u32)((now - t_prev) / COUNTS_PER_MS);
-                    t_prev = now;
-
-                    if (log_enabled) {
-                        if (!log_header_written) {
-                            strcpy(buf, "Time_ms,Delta_ms,Kp,Ki,Kd,Des1,Act1,Err1,Des2,Act2,Err2\n");
-                            f_write(&fil, buf, strlen(buf), &bw);
-                            log_header_written = true;
-                        }
-                        int len = snprintf(buf, sizeof(buf), "%lu,%lu,%.3f,%.3f,%.3f,%d,%d,%d,%d,%d,%d\n",
-                                           sys, del, kp_f, ki_f, kd_f,
-                                           des1, act1, des1-act1,
-                                           des2, act2, des2-act2);
-                        f_write(&fil, buf, len, &bw);
-                    }
+                    // 축별로 같은 제어 틱의 desired/actual 과 PL 타임스탬프를 함께 읽음
+                    maxon_snapshot_t s1, s2;
+                    maxon_read_snapshot_pos(BASEADDR1, &s1, pl_ts_ref);
+                    pl_ts_ref = s1.ts;
+                    maxon_read_snapshot_pos(BASEADDR2, &s2, pl_ts_ref);
+                    log_sample(&s1, &s2, kp_f, ki_f, kd_f);
 
-                    t_cmd = now;
+                    t_cmd += interval;  // 누적 오차 없이 고정 주기 유지
                 }
             }
             f_sync(&fil);
             printf("[OK] Trajectory done.\n");
         }
         else if (mode == 3) {
-            // Read All Status
-            u32 val_kpki1 = Xil_In32(BASEADDR1 + REG_KPKI);
-            u32 val_kd1   = Xil_In32(BASEADDR1 + REG_KD);
-            u32 val_des1  = Xil_In32(BASEADDR1 + REG_DESIRED);
-            u32 val_act1  = Xil_In32(BASEADDR1 + REG_ACTUAL);
-
-            u32 val_kpki2 = Xil_In32(BASEADDR2 + REG_KPKI);
-            u32 val_kd2   = Xil_In32(BASEADDR2 + REG_KD);
-            u32 val_des2  = Xil_In32(BASEADDR2 + REG_DESIRED);
-            u32 val_act2  = Xil_In32(BASEADDR2 + REG_ACTUAL);
-
-            printf("--- Axis 1 ---\n");
-            printf("Kp=%.3f, Ki=%.3f, Kd=%.3f\n", q78_to_float(val_kpki1 & 0x7FFF), q78_to_float((val_kpki1 >> 16) & 0x7FFF), q78_to_float(val_kd1 & 0x7FFF));
-            printf("Desired=%d, Actual=%d\n", (int)val_des1, (int)val_act1);
-
-            printf("--- Axis 2 ---\n");
-            printf("Kp=%.3f, Ki=%.3f, Kd=%.3f\n", q78_to_float(val_kpki2 & 0x7FFF), q78_to_float((val_kpki2 >> 16) & 0x7FFF), q78_to_float(val_kd2 & 0x7FFF));
-            printf("Desired=%d, Actual=%d\n", (int)val_des2, (int)val_act2);
+            // Read All Status: 게인 + 축별 스냅샷 (한 틱의 일관된 값)
+            UINTPTR bases[NUM_AXES] = { BASEADDR1, BASEADDR2 };
+            for (int i = 0; i < NUM_AXES; i++) {
+                u32 val_kpki = Xil_In32(bases[i] + REG_KPKI);
+                u32 val_kd   = Xil_In32(bases[i] + REG_KD);
+                maxon_snapshot_t s;
+                maxon_read_snapshot(bases[i], &s);
+
+                printf("--- Axis %d ---\n", i + 1);
+                printf("Kp=%.3f, Ki=%.3f, Kd=%.3f\n", q78_to_float(val_kpki & 0x7FFF), q78_to_float((val_kpki >> 16) & 0x7FFF), q78_to_float(val_kd & 0x7FFF));
+                if (Xil_In32(bases[i] + REG_PID2_CTRL) & PID2_CTRL_SELECT)
+                    printf("2-DOF PID active: Kp=%g, Ki=%g, Kd=%g, I=%.2f\n",
+                           pid2_gain_decode(Xil_In32(bases[i] + REG_PID2_KP)),
+                           pid2_gain_decode(Xil_In32(bases[i] + REG_PID2_KI)),
+                           pid2_gain_decode(Xil_In32(bases[i] + REG_PID2_KD)), pid2_read_integ(bases[i]));
+                u64 t_us = (s.ts - pl_ts_start) / (PL_TS_HZ / 1000000);
+                printf("Tick=%lu, Time=%llu.%03lu ms\n", s.tick, t_us / 1000, (u32)(t_us % 1000));
+                printf("Desired=%d, Actual=%d, Error=%d, Control=%d, Flags=0x%lx\n",
+                       (int)s.desired, (int)s.actual, (int)s.error, (int)s.control, s.flags);
+
+                safety_status_t st;
+                char f1[48], f2[48];
+                safety_read(bases[i], &st);
+                u64 trip_us = st.trip_ts ? (st.trip_ts - pl_ts_start) / (PL_TS_HZ / 1000000) : 0;
+                printf("Safety: %s, last fault=%s at %llu.%03lu ms, live=%s\n", st.tripped ? "TRIPPED" : "ok",
+                       safety_fault_str(st.fault, f1, sizeof(f1)),
+                       trip_us / 1000, (u32)(trip_us % 1000),
+                       safety_fault_str(st.live, f2, sizeof(f2)));
+
+                enc_status_t es;
+                enc_read(bases[i], &es);
+                printf("Encoder: pos64=%lld, invalid=%lu%s%s, index=%s%lld\n",
+                       (long long)es.position, es.invalid,
+                       (es.stat & ENC_STAT_INVALID) ? " [INVALID]" : "",
+                       (es.stat & ENC_STAT_INDEX_ERR) ? " [INDEX SPACING]" : "",
+                       (es.stat & ENC_STAT_INDEX_SEEN) ? "" : "(none) ",
+                       (long long)es.index_position);
+            }
+
+            cc_status_t cs;
+            cc_read(BASEADDR1, &cs);
+            printf("--- Contour ---\n");
+            printf("%s, error=%.2f, peak=%.2f counts%s\n",
+                   (Xil_In32(BASEADDR1 + REG_CC_CTRL) & CC_CTRL_ENABLE) ? "Coupling ON" : "Coupling OFF",
+                   cs.err, cs.peak, cs.dir_valid ? "" : " (no path direction yet)");
         }
         else if (mode == 4) {
             // Reset All: 로그 헤더 플래그 초기화
@@ -234,6 +404,453 @@ int main() {
                 printf("[LOG] DISABLED.\n");
             }
         }
+        else if (mode == 6) {
+            // 6. DMA 텔레메트리 캡처: 완료된 DDR 버퍼를 그대로 SD 에 기록 (tlm_frame_t 배열)
+            if (!tlm_dma_ok) { printf("[X] DMA telemetry not available.\n"); continue; }
+
+            u32 cap_sec = 0;
+            printf("Enter capture time (s): ");
+            if (scanf("%lu", &cap_sec) != 1 || cap_sec == 0) { printf("[X] Invalid time.\n"); flush_stdin(); continue; }
+
+            FIL cap;
+            char cap_name[12];  // "CAPxx.BIN"
+            snprintf(cap_name, sizeof(cap_name), "CAP%02d.BIN", cap_file_counter++);
+            res = f_open(&cap, cap_name, FA_CREATE_ALWAYS | FA_WRITE);
+            if (res != FR_OK) { printf("[ERR] f_open capture: %d\n", res); continue; }
+
+            if (tlm_dma_start() != XST_SUCCESS) {
+                printf("[ERR] DMA start failed.\n");
+                f_close(&cap);
+                continue;
+            }
+            printf("[CAP] %s for %lu s...\n", cap_name, cap_sec);
+
+            XTime t_cap0, now;
+            XTime_GetTime(&t_cap0);
+            XTime t_cap_end = t_cap0 + (XTime)COUNTS_PER_SECOND * cap_sec;
+            u32 frames = 0;
+            UINT bw;
+            do {
+                XTime_GetTime(&now);
+                if (now >= t_cap_end && tlm_dma_running()) tlm_dma_stop();
+
+                u32 n;
+                int id;
+                const tlm_frame_t *f = tlm_dma_acquire(&n, &id);
+                if (f) {
+                    f_write(&cap, f, n * sizeof(tlm_frame_t), &bw);
+                    frames += n;
+                    tlm_dma_release(id);
+                } else if (!tlm_dma_running()) {
+                    break;
+                }
+            } while (1);
+            f_close(&cap);
+
+            tlm_dma_stats_t st;
+            tlm_dma_get_stats(&st);
+            printf("[OK] Captured %lu frames (%lu buffers). lost=%lu, pl_drops=%lu, starved=%lu, errors=%lu\n",
+                   frames, st.completed, st.frames_lost, st.pl_drops, st.starved, st.errors);
+        }
+        else if (mode == 7) {
+            // 7. 게인 스윕: 현재 위치를 홈으로, 격자/적응 탐색 후 축별 최적 게인 적용
+            int backend, method, scenario, log_runs;
+            sweep_cfg_t cfg;
+            sweep_cfg_default(&cfg);
+            cfg.cmd_hz = CMD_FREQ_HZ;
+
+            printf("Backend (1: hardware, 2: simulation): ");
+            if (scanf("%d", &backend) != 1 || backend < 1 || backend > 2) { printf("[X] Invalid.\n"); flush_stdin(); continue; }
+            printf("Method (1: grid, 2: adaptive): ");
+            if (scanf("%d", &method) != 1 || method < 1 || method > 2) { printf("[X] Invalid.\n"); flush_stdin(); continue; }
+            printf("Scenario (1: step, 2: quintic): ");
+            if (scanf("%d", &scenario) != 1 || scenario < 1 || scenario > 2) { printf("[X] Invalid.\n"); flush_stdin(); continue; }
+            printf("Move distance Axis1 Axis2 (counts): ");
+            if (scanf("%ld %ld", &cfg.target[0], &cfg.target[1]) != 2) { printf("[X] Invalid.\n"); flush_stdin(); continue; }
+
+            // 두 축 같은 범위로 시작 (적응 탐색은 축별로 따로 좁혀짐)
+            sweep_range_t r;
+            if (!read_gain_range("Kp", &r.lo[SWEEP_KP], &r.hi[SWEEP_KP], &r.steps[SWEEP_KP]) ||
+                !read_gain_range("Ki", &r.lo[SWEEP_KI], &r.hi[SWEEP_KI], &r.steps[SWEEP_KI]) ||
+                !read_gain_range("Kd", &r.lo[SWEEP_KD], &r.hi[SWEEP_KD], &r.steps[SWEEP_KD]))
+                continue;
+            printf("Log each run to SWxxx.CSV (0/1): ");
+            if (scanf("%d", &log_runs) != 1) { flush_stdin(); log_runs = 0; }
+
+            cfg.method = method == 2 ? SWEEP_ADAPTIVE : SWEEP_GRID;
+            cfg.scenario = scenario == 1 ? SWEEP_STEP : SWEEP_QUINTIC;
+            cfg.log_runs = log_runs != 0;
+
+            sweep_backend_t be;
+            if (backend == 1) {
+                be = (sweep_backend_t){ hw_set_gains, hw_set_desired, hw_read, hw_wait_cmd, NULL };
+                XTime_GetTime(&sweep_t_cmd);
+            } else {
+                plant_param_t prm;
+                plant_param_default(&prm);
+                for (int i = 0; i < NUM_AXES; i++) plant_sim_init(&sweep_sim[i], &prm);
+                be = (sweep_backend_t){ sim_set_gains, sim_set_desired, sim_read, sim_wait_cmd, NULL };
+            }
+
+            for (int i = 0; i < NUM_AXES; i++) {
+                s32 d, home;
+                be.read(be.ctx, i, &d, &home);
+                cfg.range[i] = r;
+                cfg.home[i] = home;
+                cfg.target[i] += home;
+            }
+
+            // 스윕은 자체 파일을 쓰므로 진행 중인 로그는 닫고 끝난 뒤 새 파일로 재개
+            if (log_enabled) f_close(&fil);
+            sweep_io_t io = { sweep_open, sweep_write, sweep_close, NULL };
+            sweep_result_t sr;
+            int ret = sweep_run(&cfg, &be, &io, sweep_file_counter++, &sr);
+            printf("[%s] Sweep %s: %lu runs, %lu aborted axis-runs.\n", ret == 0 ? "OK" : "ERR",
+                   ret == 0 ? "done" : "stopped (homing failed)", sr.runs, sr.aborted);
+
+            if (log_enabled) {
+                snprintf(log_filename, sizeof(log_filename), "LOG%02d.CSV", log_file_counter++);
+                if (f_open(&fil, log_filename, FA_CREATE_ALWAYS | FA_WRITE) == FR_OK) log_header_written = false;
+                else log_enabled = false;
+            }
+        }
+        else if (mode == 8) {
+            // 8. ILC: mode 2 와 같은 정방향 → 복귀를 반복하며 축별 보정 테이블 학습
+            int sub;
+            printf("ILC (1: run, 2: reset table, 3: parameters [L=%.2f lead=%ld Q=%.1f Hz]): ",
+                   ilc_cfg.gain, ilc_cfg.lead, ilc_cfg.q_cutoff_hz);
+            if (scanf("%d", &sub) != 1 || sub < 1 || sub > 3) { printf("[X] Invalid.\n"); flush_stdin(); continue; }
+
+            if (sub == 2) {
+                for (int i = 0; i < NUM_AXES; i++) ilc_reset(&ilc_axis[i]);
+                printf("[ILC] Table reset.\n");
+                continue;
+            }
+            if (sub == 3) {
+                ilc_cfg_t c = ilc_cfg;
+                printf("Learning gain, lead (samples), Q cutoff (Hz): ");
+                if (scanf("%f %ld %f", &c.gain, &c.lead, &c.q_cutoff_hz) != 3 || c.gain <= 0.0f || c.gain > 1.0f ||
+                    c.lead < 0 || c.q_cutoff_hz < 0.0f) {
+                    printf("[X] Invalid.\n"); flush_stdin(); continue;
+                }
+                ilc_cfg = c;
+                for (int i = 0; i < NUM_AXES; i++) ilc_axis[i].cfg = c;    // 테이블은 유지
+                printf("[OK] ILC parameters set.\n");
+                continue;
+            }
+
+            u32 reps = 0;
+            printf("Enter target pos Axis1: "); scanf("%d", &target_pos1);
+            printf("Enter target pos Axis2: "); scanf("%d", &target_pos2);
+            printf("Repetitions: ");
+            if (scanf("%lu", &reps) != 1 || reps == 0) { printf("[X] Invalid.\n"); flush_stdin(); continue; }
+
+            // 같은 계획이면 학습된 테이블과 시작점을 그대로 사용
+            s32 qf[NUM_AXES] = { target_pos1, target_pos2 };
+            u32 phase_n = 1000 * (CMD_FREQ_HZ / 1000);
+            if (!ilc_valid || memcmp(qf, ilc_qf, sizeof(qf)) != 0) {
+                ilc_q0[0] = (s32)Xil_In32(BASEADDR1 + REG_ACTUAL);
+                ilc_q0[1] = (s32)Xil_In32(BASEADDR2 + REG_ACTUAL);
+                memcpy(ilc_qf, qf, sizeof(qf));
+                for (int i = 0; i < NUM_AXES; i++) ilc_init(&ilc_axis[i], &ilc_cfg, 2 * phase_n);
+                ilc_valid = true;
+                printf("[ILC] New plan, table cleared.\n");
+            }
+            traj_profile_init(&traj, NUM_AXES, true);
+            traj_profile_add(&traj, phase_n, ilc_q0, ilc_qf);
+            traj_profile_add(&traj, phase_n, ilc_qf, ilc_q0);
+
+            XTime t_cmd;
+            XTime_GetTime(&t_cmd);
+            XTime interval = (XTime)XTIME_PER_CMD;
+
+            for (u32 r = 0; r < reps; r++) {
+                s32 ref[TRAJ_MAX_AXES];
+                u32 n = 0;
+                traj_profile_rewind(&traj);
+                pl_ts_ref = maxon_read_ts(BASEADDR1);
+                while (1) {
+                    XTime now;
+                    XTime_GetTime(&now);
+                    if ((now - t_cmd) < interval) continue;
+
+                    if (!traj_profile_step(&traj, ref)) break;
+                    Xil_Out32(BASEADDR1 + REG_DESIRED, ilc_apply(&ilc_axis[0], n, ref[0]));
+                    Xil_Out32(BASEADDR2 + REG_DESIRED, ilc_apply(&ilc_axis[1], n, ref[1]));
+
+                    maxon_snapshot_t s1, s2;
+                    maxon_read_snapshot_pos(BASEADDR1, &s1, pl_ts_ref);
+                    pl_ts_ref = s1.ts;
+                    maxon_read_snapshot_pos(BASEADDR2, &s2, pl_ts_ref);
+                    ilc_record(&ilc_axis[0], n, ref[0], s1.actual);
+                    ilc_record(&ilc_axis[1], n, ref[1], s2.actual);
+                    log_sample(&s1, &s2, kp_f, ki_f, kd_f);
+
+                    n++;
+                    t_cmd += interval;
+                }
+
+                // 반복 사이 (다음 반복 시작 전) 테이블 갱신, 소요 시간만큼 주기 기준 재설정
+                ilc_iter_t it1 = ilc_update(&ilc_axis[0]);
+                ilc_iter_t it2 = ilc_update(&ilc_axis[1]);
+                XTime_GetTime(&t_cmd);
+                printf("[ILC] iter %lu: Axis1 rms=%.1f peak=%ld%s, Axis2 rms=%.1f peak=%ld%s\n",
+                       ilc_axis[0].iter, it1.rms, it1.peak, ilc_axis[0].frozen ? " (frozen)" : "",
+                       it2.rms, it2.peak, ilc_axis[1].frozen ? " (frozen)" : "");
+            }
+            f_sync(&fil);
+            printf("[OK] ILC repetitions done.\n");
+        }
+        else if (mode == 9) {
+            // 9. biquad 단 설정: 두 축에 같은 단을 설계/로드 후 한 번에 commit
+            int chain, stage, type;
+            float f0 = 0.0f, q = 0.707f;
+            UINTPTR bases[NUM_AXES] = { BASEADDR1, BASEADDR2 };
+
+            printf("Chain (1: control output, 2: position feedback): ");
+            if (scanf("%d", &chain) != 1 || chain < 1 || chain > 2) { printf("[X] Invalid.\n"); flush_stdin(); continue; }
+            printf("Stage (0-%d): ", BQ_NUM_STAGES - 1);
+            if (scanf("%d", &stage) != 1 || stage < 0 || stage >= BQ_NUM_STAGES) { printf("[X] Invalid.\n"); flush_stdin(); continue; }
+            printf("Type (0: bypass, 1: notch, 2: low-pass): ");
+            if (scanf("%d", &type) != 1 || type < 0 || type > 2) { printf("[X] Invalid.\n"); flush_stdin(); continue; }
+            if (type != 0) {
+                printf("Frequency (Hz) and Q: ");
+                if (scanf("%f %f", &f0, &q) != 2 || f0 <= 0.0f || f0 >= BQ_FS_HZ / 2 || q <= 0.0f) {
+                    printf("[X] Invalid.\n"); flush_stdin(); continue;
+                }
+            }
+            chain = (chain == 1) ? BQ_CHAIN_CTRL : BQ_CHAIN_FB;
+
+            biquad_coef_t c;
+            if (type == 1) biquad_notch(&c, f0, q);
+            else if (type == 2) biquad_lowpass(&c, f0, q);
+            else biquad_identity(&c);
+
+            for (int i = 0; i < NUM_AXES; i++) {
+                u32 mask = biquad_enabled(bases[i]);
+                if (type != 0) mask |= BQ_STAGE_BIT(chain, stage);
+                else mask &= ~BQ_STAGE_BIT(chain, stage);
+                biquad_load_stage(bases[i], chain, stage, &c);
+                if (biquad_commit(bases[i], mask, false) != 0)
+                    printf("[ERR] Axis %d commit timeout.\n", i + 1);
+                u32 st = Xil_In32(bases[i] + REG_BQ_STAT);
+                printf("[OK] Axis %d: enable=0x%04lx sat=%lu\n", i + 1, (st >> 2) & 0xFFFF, st & 0x3);
+                Xil_Out32(bases[i] + REG_BQ_STAT, 0x3);    // 포화 플래그 클리어
+            }
+        }
+        else if (mode == 10) {
+            // 10. 외란 관측기: 공칭 모델 / Q-filter 설정 후 두 축 보상 on/off, 추정값 확인
+            int sub;
+            UINTPTR bases[NUM_AXES] = { BASEADDR1, BASEADDR2 };
+
+            printf("DOB (1: enable, 2: disable, 3: parameters [J=%.3g B=%.3g Q=%.0f Hz win=%lu lim=%lu], 4: monitor): ",
+                   dob_cfg.inertia, dob_cfg.damping, dob_cfg.q_cutoff_hz, dob_cfg.vel_shift, dob_cfg.limit);
+            if (scanf("%d", &sub) != 1 || sub < 1 || sub > 4) { printf("[X] Invalid.\n"); flush_stdin(); continue; }
+
+            if (sub == 3) {
+                dob_cfg_t c = dob_cfg;
+                printf("J (ctrl/(count/s^2)), B (ctrl/(count/s)), Q cutoff (Hz), window shift (0-%d), limit: ",
+                       DOB_VEL_SHIFT_MAX);
+                if (scanf("%f %f %f %lu %lu", &c.inertia, &c.damping, &c.q_cutoff_hz, &c.vel_shift, &c.limit) != 5 ||
+                    c.inertia < 0.0f || c.damping < 0.0f || c.q_cutoff_hz <= 0.0f || c.q_cutoff_hz >= DOB_FS_HZ / 2 ||
+                    c.vel_shift > DOB_VEL_SHIFT_MAX) {
+                    printf("[X] Invalid.\n"); flush_stdin(); continue;
+                }
+                dob_cfg = c;
+                printf("[OK] DOB parameters set (applied on next enable).\n");
+                continue;
+            }
+
+            for (int i = 0; i < NUM_AXES; i++) {
+                if (sub == 1) {
+                    if (dob_configure(bases[i], &dob_cfg, true) != 0)
+                        printf("[ERR] Axis %d: model out of register range.\n", i + 1);
+                    else
+                        printf("[OK] Axis %d: DOB enabled.\n", i + 1);
+                } else if (sub == 2) {
+                    dob_enable(bases[i], false);
+                    printf("[OK] Axis %d: DOB disabled.\n", i + 1);
+                }
+            }
+
+            if (sub == 4) {
+                // 약 1초 동안 100 ms 마다 추정값 출력 (보상 여부와 무관하게 항상 추정)
+                for (int n = 0; n < 10; n++) {
+                    XTime t0, t1;
+                    XTime_GetTime(&t0);
+                    printf("[DOB] d1=%6ld d2=%6ld\n", (long)dob_read_est(BASEADDR1), (long)dob_read_est(BASEADDR2));
+                    do { XTime_GetTime(&t1); } while (t1 - t0 < COUNTS_PER_SECOND / 10);
+                }
+            }
+        }
+        else if (mode == 11) {
+            // 11. 안전 감시기: 한계 설정 / 해제 / 소프트웨어 트립 (판정은 PL 에서 클럭 단위)
+            int sub;
+            UINTPTR bases[NUM_AXES] = { BASEADDR1, BASEADDR2 };
+
+            printf("Safety (1: apply [follow=%lu speed=%lu sat=%lu wd=%lu us mask=0x%02lx %s], 2: set limits, 3: clear, 4: trip): ",
+                   safety_cfg.follow_limit, safety_cfg.speed_limit, safety_cfg.sat_ticks, safety_cfg.wd_timeout_us,
+                   safety_cfg.mask, safety_cfg.brake ? "brake" : "coast");
+            if (scanf("%d", &sub) != 1 || sub < 1 || sub > 4) { printf("[X] Invalid.\n"); flush_stdin(); continue; }
+
+            if (sub == 2) {
+                safety_cfg_t c = safety_cfg;
+                int brake;
+                printf("Follow (counts), speed (counts/tick), sat (ticks), watchdog (us, 0 = off), mask (hex), brake (0/1): ");
+                if (scanf("%lu %lu %lu %lu %lx %d", &c.follow_limit, &c.speed_limit, &c.sat_ticks,
+                          &c.wd_timeout_us, &c.mask, &brake) != 6 || c.mask > 0x1F) {
+                    printf("[X] Invalid.\n"); flush_stdin(); continue;
+                }
+                c.brake = (brake != 0);
+                if (c.wd_timeout_us != 0)
+                    printf("[WARN] Watchdog is not kicked while this menu waits; use it with the CPU1 RT loop.\n");
+                safety_cfg = c;
+                printf("[OK] Limits set (use 1 to apply).\n");
+                continue;
+            }
+
+            for (int i = 0; i < NUM_AXES; i++) {
+                if (sub == 1) {
+                    safety_configure(bases[i], &safety_cfg);
+                    printf("[OK] Axis %d: limits applied.\n", i + 1);
+                } else if (sub == 3) {
+                    u32 es;
+                    int rc = safety_clear(bases[i], &es);
+                    if (es)
+                        printf("[WARN] Axis %d: encoder fault latched (%s%s), cleared.\n", i + 1,
+                               (es & ENC_STAT_INVALID) ? "invalid transition " : "",
+                               (es & ENC_STAT_INDEX_ERR) ? "index spacing" : "");
+                    if (rc != 0) {
+                        safety_status_t st;
+                        char f[48];
+                        safety_read(bases[i], &st);
+                        printf("[ERR] Axis %d: still tripped (%s).\n", i + 1, safety_fault_str(st.live, f, sizeof(f)));
+                    } else {
+                        printf("[OK] Axis %d: cleared.\n", i + 1);
+                    }
+                } else {
+                    safety_trip(bases[i]);
+                    printf("[OK] Axis %d: tripped.\n", i + 1);
+                }
+            }
+        }
+        else if (mode == 12) {
+            // 12. 엔코더: 글리치 필터 / 디코드 모드 / Index 간격 검사, 오류 클리어, Index 원점 탐색
+            int sub;
+            UINTPTR bases[NUM_AXES] = { BASEADDR1, BASEADDR2 };
+            static const char *mode_names[] = { "x4", "x2", "x1" };
+
+            printf("Encoder (1: apply [filter=%lu clk %s cpr=%lu tol=%lu], 2: set, 3: clear errors, 4: home to index): ",
+                   enc_cfg.filter_depth, mode_names[enc_cfg.mode], enc_cfg.index_cpr, enc_cfg.index_tol);
+            if (scanf("%d", &sub) != 1 || sub < 1 || sub > 4) { printf("[X] Invalid.\n"); flush_stdin(); continue; }
+
+            if (sub == 2) {
+                enc_cfg_t c = enc_cfg;
+                printf("Filter (clocks, 0 = min latency), mode (0: x4, 1: x2, 2: x1), index cpr (0 = off), tol: ");
+                if (scanf("%lu %lu %lu %lu", &c.filter_depth, &c.mode, &c.index_cpr, &c.index_tol) != 4 ||
+                    c.filter_depth > 255 || c.mode > ENC_MODE_X1 || c.index_cpr > 0xFFFF || c.index_tol > 255) {
+                    printf("[X] Invalid.\n"); flush_stdin(); continue;
+                }
+                enc_cfg = c;
+                printf("[OK] Encoder settings set (use 1 to apply with axes stopped).\n");
+                continue;
+            }
+
+            for (int i = 0; i < NUM_AXES; i++) {
+                if (sub == 1) {
+                    enc_configure(bases[i], &enc_cfg);
+                    printf("[OK] Axis %d: encoder configured.\n", i + 1);
+                } else if (sub == 3) {
+                    enc_clear(bases[i]);
+                    printf("[OK] Axis %d: encoder errors cleared.\n", i + 1);
+                } else {
+                    // 1 카운트/ms 로 최대 1.5 회전
+                    s64 idx;
+                    u32 travel = enc_cfg.index_cpr ? enc_cfg.index_cpr * 3 / 2 : 3072;
+                    if (enc_home_index(bases[i], 1, 1000, travel, &idx) != 0)
+                        printf("[ERR] Axis %d: no index within %lu counts.\n", i + 1, travel);
+                    else
+                        printf("[OK] Axis %d: index at %lld.\n", i + 1, (long long)idx);
+                }
+            }
+        }
+        else if (mode == 13) {
+            // 13. 2자유도 PID: 게인 / 가중치 / D 필터 설정, 기존 Q7.8 제어기와 전환
+            int sub;
+            UINTPTR bases[NUM_AXES] = { BASEADDR1, BASEADDR2 };
+
+            printf("2-DOF PID (1: set [Kp=%g Ki=%g Kd=%g b=%.2f c=%.2f D LPF=%.0f Hz], 2: copy Q7.8 gains, 3: select 2-DOF, 4: select Q7.8, 5: clear state): ",
+                   pid2_cfg.kp, pid2_cfg.ki, pid2_cfg.kd, pid2_cfg.b, pid2_cfg.c, pid2_cfg.d_cutoff_hz);
+            if (scanf("%d", &sub) != 1 || sub < 1 || sub > 5) { printf("[X] Invalid.\n"); flush_stdin(); continue; }
+
+            if (sub == 1) {
+                pid2_cfg_t c = pid2_cfg;
+                printf("Kp, Ki, Kd, b (0-1.99), c (0-1.99), D cutoff (Hz, 0 = off): ");
+                if (scanf("%f %f %f %f %f %f", &c.kp, &c.ki, &c.kd, &c.b, &c.c, &c.d_cutoff_hz) != 6 ||
+                    c.d_cutoff_hz < 0.0f || c.d_cutoff_hz >= PID2_FS_HZ / 2) {
+                    printf("[X] Invalid.\n"); flush_stdin(); continue;
+                }
+                pid2_cfg = c;
+            } else if (sub == 2) {
+                // 축 1 의 현재 Q7.8 게인을 그대로 옮김 (가중치 / 필터는 유지)
+                pid2_cfg_from_q78(&pid2_cfg, Xil_In32(BASEADDR1 + REG_KPKI), Xil_In32(BASEADDR1 + REG_KD));
+            }
+
+            for (int i = 0; i < NUM_AXES; i++) {
+                if (sub <= 2) {
+                    if (pid2_configure(bases[i], &pid2_cfg) != 0)
+                        printf("[WARN] Axis %d: value out of range, clamped.\n", i + 1);
+                    printf("[OK] Axis %d: Kp=%g Ki=%g Kd=%g Kt=%g\n", i + 1,
+                           pid2_gain_decode(Xil_In32(bases[i] + REG_PID2_KP)),
+                           pid2_gain_decode(Xil_In32(bases[i] + REG_PID2_KI)),
+                           pid2_gain_decode(Xil_In32(bases[i] + REG_PID2_KD)),
+                           pid2_gain_decode(Xil_In32(bases[i] + REG_PID2_KT)));
+                } else if (sub == 5) {
+                    pid2_clear(bases[i]);
+                    printf("[OK] Axis %d: state cleared.\n", i + 1);
+                } else {
+                    pid2_select(bases[i], sub == 3);
+                    printf("[OK] Axis %d: %s controller active (I=%.2f).\n", i + 1,
+                           sub == 3 ? "2-DOF" : "Q7.8", pid2_read_integ(bases[i]));
+                }
+            }
+        }
+        else if (mode == 14) {
+            // 14. 윤곽 제어: 결합 게인 / 제한 / 속도 필터 설정 (축 0 레지스터), 켜기 / 끄기, 최대 윤곽 오차 확인
+            int sub;
+            UINTPTR bases[NUM_AXES] = { BASEADDR1, BASEADDR2 };
+
+            printf("Contouring (1: set & enable [Kc=%g limit=%lu filter=2^%lu ticks min speed=%.0f cnt/s], 2: enable, 3: disable, 4: clear peak, 5: status): ",
+                   cc_cfg.gain, cc_cfg.limit, cc_cfg.vel_shift, cc_cfg.min_speed);
+            if (scanf("%d", &sub) != 1 || sub < 1 || sub > 5) { printf("[X] Invalid.\n"); flush_stdin(); continue; }
+
+            if (sub == 1) {
+                cc_cfg_t c = cc_cfg;
+                printf("Kc (control / count), limit (0-4000), filter shift (0-%d), min speed (counts/s): ", CC_VEL_SHIFT_MAX);
+                if (scanf("%f %lu %lu %f", &c.gain, &c.limit, &c.vel_shift, &c.min_speed) != 4 ||
+                    c.gain < 0.0f || c.limit > 4000 || c.vel_shift > CC_VEL_SHIFT_MAX || c.min_speed < 0.0f) {
+                    printf("[X] Invalid.\n"); flush_stdin(); continue;
+                }
+                cc_cfg = c;
+                if (cc_configure(BASEADDR1, &cc_cfg, true) != 0)
+                    printf("[WARN] Value out of range, clamped.\n");
+                printf("[OK] Contouring enabled: Kc=%g\n", pid2_gain_decode(Xil_In32(BASEADDR1 + REG_CC_GAIN)));
+            } else if (sub == 2 || sub == 3) {
+                cc_enable(BASEADDR1, sub == 2);
+                printf("[OK] Contouring %s.\n", sub == 2 ? "enabled" : "disabled");
+            } else if (sub == 4) {
+                cc_clear(BASEADDR1);
+                printf("[OK] Contour state cleared.\n");
+            }
+
+            cc_status_t cs;
+            for (int i = 0; i < NUM_AXES; i++) {
+                cc_read(bases[i], &cs);
+                printf("Axis %d: correction=%d\n", i + 1, (int)cs.corr);
+            }
+            printf("Contour error=%.2f, peak=%.2f counts%s\n", cs.err, cs.peak,
+                   cs.dir_valid ? "" : " (no path direction yet)");
+        }
     }
     return 0;
 }
@@ -0,0 +1,189 @@
+// tlm_dma.c: AXI DMA 텔레메트리 캡처 구현 (simple mode + 완료 인터럽트 재장전)
+
+#include <string.h>
+#include "xparameters.h"
+#include "xaxidma.h"
+#include "xgpio.h"
+#include "xscugic.h"
+#include "xil_cache.h"
+#include "xil_exception.h"
+#include "xtime_l.h"
+#include "tlm_dma.h"
+
+#define TLM_GPIO_DEVICE_ID      XPAR_AXI_GPIO_0_DEVICE_ID   // ch1: enable, ch2: drop_count
+#define TLM_BUF_MASK            (TLM_DMA_NUM_BUFS - 1)
+
+static XAxiDma dma;
+static XScuGic gic;
+static XGpio gpio;
+
+// HP0 는 캐시 비일관 → 장전 전/완료 후 invalidate (캐시 라인 정렬)
+static u8 tlm_bufs[TLM_DMA_NUM_BUFS][TLM_PACKET_BYTES] __attribute__((aligned(64)));
+static tlm_dma_desc_t tlm_desc[TLM_DMA_NUM_BUFS];
+
+static volatile int armed_id = -1;
+static volatile u32 next_arm = 0;
+static u32 next_consume = 0;
+static volatile bool running = false;
+static volatile u32 done_seq = 0;
+static bool frame_sync = false;
+static u32 expected_frame = 0;
+static tlm_dma_stats_t stats;
+
+// 다음 FREE 버퍼로 DMA 장전 (ISR 또는 인터럽트 비활성 구간에서만 호출)
+static int arm_next(void) {
+    u32 id = next_arm & TLM_BUF_MASK;
+    if (tlm_desc[id].state != TLM_BUF_FREE) {
+        stats.starved++;
+        armed_id = -1;
+        return -1;
+    }
+    Xil_DCacheInvalidateRange((UINTPTR)tlm_bufs[id], TLM_PACKET_BYTES);
+    tlm_desc[id].state = TLM_BUF_ARMED;
+    if (XAxiDma_SimpleTransfer(&dma, (UINTPTR)tlm_bufs[id], TLM_PACKET_BYTES,
+                               XAXIDMA_DEVICE_TO_DMA) != XST_SUCCESS) {
+        tlm_desc[id].state = TLM_BUF_FREE;
+        stats.errors++;
+        armed_id = -1;
+        return -1;
+    }
+    armed_id = (int)id;
+    next_arm++;
+    return 0;
+}
+
+static void s2mm_isr(void *ref) {
+    (void)ref;
+    u32 irq = XAxiDma_IntrGetIrq(&dma, XAXIDMA_DEVICE_TO_DMA);
+    XAxiDma_IntrAckIrq(&dma, irq, XAXIDMA_DEVICE_TO_DMA);
+
+    if (irq & XAXIDMA_IRQ_ERROR_MASK) {
+        stats.errors++;
+        running = false;
+        armed_id = -1;
+        return;
+    }
+
+    if ((irq & XAXIDMA_IRQ_IOC_MASK) && armed_id >= 0) {
+        int id = armed_id;
+        tlm_desc[id].length = XAxiDma_ReadReg(dma.RegBase, XAXIDMA_RX_OFFSET + XAXIDMA_BUFFLEN_OFFSET);
+        tlm_desc[id].seq = done_seq++;
+        tlm_desc[id].state = TLM_BUF_FULL;
+        stats.completed++;
+        armed_id = -1;
+        if (running) arm_next();
+    }
+}
+
+int tlm_dma_init(void) {
+    XAxiDma_Config *cfg = XAxiDma_LookupConfig(TLM_DMA_DEVICE_ID);
+    if (!cfg || XAxiDma_CfgInitialize(&dma, cfg) != XST_SUCCESS) return XST_FAILURE;
+    if (XAxiDma_HasSg(&dma)) return XST_FAILURE;            // simple mode 로 구성할 것
+
+    if (XGpio_Initialize(&gpio, TLM_GPIO_DEVICE_ID) != XST_SUCCESS) return XST_FAILURE;
+    XGpio_SetDataDirection(&gpio, 1, 0x0);                  // enable: 출력
+    XGpio_SetDataDirection(&gpio, 2, 0xFFFFFFFF);           // drop_count: 입력
+    XGpio_DiscreteWrite(&gpio, 1, 0);
+
+    XScuGic_Config *gic_cfg = XScuGic_LookupConfig(TLM_GIC_DEVICE_ID);
+    if (!gic_cfg || XScuGic_CfgInitialize(&gic, gic_cfg, gic_cfg->CpuBaseAddress) != XST_SUCCESS)
+        return XST_FAILURE;
+    XScuGic_SetPriorityTriggerType(&gic, TLM_DMA_IRQ_ID, 0xA0, 0x3);
+    if (XScuGic_Connect(&gic, TLM_DMA_IRQ_ID, (Xil_InterruptHandler)s2mm_isr, NULL) != XST_SUCCESS)
+        return XST_FAILURE;
+    XScuGic_Enable(&gic, TLM_DMA_IRQ_ID);
+
+    Xil_ExceptionInit();
+    Xil_ExceptionRegisterHandler(XIL_EXCEPTION_ID_INT, (Xil_ExceptionHandler)XScuGic_InterruptHandler, &gic);
+    Xil_ExceptionEnable();
+
+    XAxiDma_IntrDisable(&dma, XAXIDMA_IRQ_ALL_MASK, XAXIDMA_DMA_TO_DEVICE);
+    XAxiDma_IntrEnable(&dma, XAXIDMA_IRQ_ALL_MASK, XAXIDMA_DEVICE_TO_DMA);
+    return XST_SUCCESS;
+}
+
+int tlm_dma_start(void) {
+    if (running) return XST_SUCCESS;
+
+    memset(tlm_desc, 0, sizeof(tlm_desc));
+    memset(&stats, 0, sizeof(stats));
+    next_arm = next_consume = done_seq = 0;
+    frame_sync = false;
+
+    running = true;
+    XScuGic_Disable(&gic, TLM_DMA_IRQ_ID);
+    int ret = arm_next();
+    XScuGic_Enable(&gic, TLM_DMA_IRQ_ID);
+    if (ret != 0) {
+        running = false;
+        return XST_FAILURE;
+    }
+
+    // DMA 장전 후 PL 스트림 시작 (패킷 경계에서 시작됨)
+    XGpio_DiscreteWrite(&gpio, 1, 1);
+    return XST_SUCCESS;
+}
+
+void tlm_dma_stop(void) {
+    // PL 은 현재 패킷을 마친 뒤 멈춘다 → 마지막 완료를 잠시 기다린 후 DMA 리셋
+    XGpio_DiscreteWrite(&gpio, 1, 0);
+    running = false;
+
+    XTime t0, now;
+    XTime_GetTime(&t0);
+    do {
+        XTime_GetTime(&now);
+    } while (armed_id >= 0 && (now - t0) < COUNTS_PER_SECOND / 50);
+
+    XScuGic_Disable(&gic, TLM_DMA_IRQ_ID);
+    if (armed_id >= 0) {
+        XAxiDma_Reset(&dma);
+        while (!XAxiDma_ResetIsDone(&dma));
+        XAxiDma_IntrEnable(&dma, XAXIDMA_IRQ_ALL_MASK, XAXIDMA_DEVICE_TO_DMA);
+        tlm_desc[armed_id].state = TLM_BUF_FREE;
+        armed_id = -1;
+    }
+    XScuGic_Enable(&gic, TLM_DMA_IRQ_ID);
+}
+
+bool tlm_dma_running(void) {
+    return running;
+}
+
+const tlm_frame_t *tlm_dma_acquire(u32 *n_frames, int *buf_id) {
+    u32 id = next_consume & TLM_BUF_MASK;
+    if (tlm_desc[id].state != TLM_BUF_FULL) return NULL;
+
+    // DMA 중 투기적으로 읽힌 캐시 라인 제거
+    Xil_DCacheInvalidateRange((UINTPTR)tlm_bufs[id], TLM_PACKET_BYTES);
+    tlm_desc[id].state = TLM_BUF_BUSY;
+
+    const tlm_frame_t *f = (const tlm_frame_t *)tlm_bufs[id];
+    u32 n = tlm_desc[id].length / sizeof(tlm_frame_t);
+
+    // 프레임 카운터 불연속 = PL 에서 버린 프레임
+    for (u32 i = 0; i < n; i++) {
+        if (frame_sync && f[i].frame_count != expected_frame)
+            stats.frames_lost += f[i].frame_count - expected_frame;
+        expected_frame = f[i].frame_count + 1;
+        frame_sync = true;
+    }
+
+    *n_frames = n;
+    *buf_id = (int)id;
+    return f;
+}
+
+void tlm_dma_release(int buf_id) {
+    XScuGic_Disable(&gic, TLM_DMA_IRQ_ID);
+    tlm_desc[buf_id].state = TLM_BUF_FREE;
+    next_consume++;
+    // 버퍼 부족으로 멈춰 있었다면 재장전
+    if (running && armed_id < 0) arm_next();
+    XScuGic_Enable(&gic, TLM_DMA_IRQ_ID);
+}
+
+void tlm_dma_get_stats(tlm_dma_stats_t *s) {
+    *s = stats;
+    s->pl_drops = XGpio_DiscreteRead(&gpio, 2);
+}
@@ -0,0 +1,75 @@
+// tlm_dma.h: AXI DMA 텔레메트리 캡처 (telemetry_axis.v → AXI DMA S2MM → HP0 → DDR)
+//
+// DDR 버퍼 링을 돌려가며 DMA 를 재장전한다. CPU 는 버퍼 완료 인터럽트에서만 개입하고,
+// 소비자는 tlm_dma_acquire() / tlm_dma_release() 로 완료된 버퍼를 복사 없이 읽는다.
+//
+//   tlm_dma_init(); tlm_dma_start();
+//   while (...) {
+//       u32 n; int id;
+//       const tlm_frame_t *f = tlm_dma_acquire(&n, &id);
+//       if (f) { ... f[0..n-1] 처리 ...; tlm_dma_release(id); }
+//   }
+//   tlm_dma_stop();
+
+#ifndef TLM_DMA_H
+#define TLM_DMA_H
+
+#include <stdbool.h>
+#include "xil_types.h"
+
+#define TLM_NUM_AXES            2
+#define TLM_FRAMES_PER_PACKET   64          // telemetry_axis FRAMES_PER_PACKET 와 일치
+#define TLM_DMA_NUM_BUFS        32          // 2의 거듭제곱, 20 kHz 에서 약 100 ms 분량
+
+#define TLM_DMA_DEVICE_ID       XPAR_AXIDMA_0_DEVICE_ID
+#define TLM_DMA_IRQ_ID          XPAR_FABRIC_AXIDMA_0_VEC_ID
+#define TLM_GIC_DEVICE_ID       XPAR_SCUGIC_SINGLE_DEVICE_ID
+
+// telemetry_axis.v 프레임 레이아웃 (mode 6 CAPxx.BIN 에 그대로 기록, 호스트는 tools/log_analyzer 가 읽음)
+typedef struct {
+    u32 frame_count;                        // PL 틱 카운터 (누락 검출용)
+    struct {
+        s32 desired;
+        s32 actual;
+        s32 error;
+        s32 control;
+        s32 disturbance;                    // DOB 추정 외란 (제어 신호 단위)
+    } axis[TLM_NUM_AXES];
+    s32 contour_err;                        // 윤곽 오차 (Q24.8 카운트, 이 프레임 control 에 들어간 보정 기준)
+} tlm_frame_t;
+
+#define TLM_PACKET_BYTES        (TLM_FRAMES_PER_PACKET * sizeof(tlm_frame_t))
+
+// 버퍼 디스크립터 상태
+enum {
+    TLM_BUF_FREE = 0,                       // 재장전 가능
+    TLM_BUF_ARMED,                          // DMA 전송 대기/진행 중
+    TLM_BUF_FULL,                           // 완료, 소비자 대기
+    TLM_BUF_BUSY,                           // 소비자가 읽는 중
+};
+
+typedef struct {
+    volatile u32 state;
+    volatile u32 length;                    // 수신 바이트 수
+    volatile u32 seq;                       // 완료 순번
+} tlm_dma_desc_t;
+
+typedef struct {
+    u32 completed;                          // 완료된 버퍼 수
+    u32 starved;                            // FREE 버퍼가 없어 DMA 가 멈춘 횟수
+    u32 errors;                             // DMA 에러 인터럽트
+    u32 frames_lost;                        // frame_count 불연속으로 검출된 누락 프레임
+    u32 pl_drops;                           // telemetry_axis drop_count (GPIO ch2)
+} tlm_dma_stats_t;
+
+int tlm_dma_init(void);
+int tlm_dma_start(void);
+void tlm_dma_stop(void);
+bool tlm_dma_running(void);
+
+const tlm_frame_t *tlm_dma_acquire(u32 *n_frames, int *buf_id);
+void tlm_dma_release(int buf_id);
+
+void tlm_dma_get_stats(tlm_dma_stats_t *stats);
+
+#endif
@@ -0,0 +1,85 @@
+// traj_bench.c: 트라젝토리 커널 마이크로벤치마크 (별도 애플리케이션으로 빌드)
+// 기존 float quintic_trajectory() 와 고정소수점 Horner / forward differencing 커널의
+// 샘플당 · 축당 CPU 사이클을 UART 로 출력한다.
+
+#include <stdio.h>
+#include "xparameters.h"
+#include "xil_types.h"
+#include "xtime_l.h"
+#include "trajectory.h"
+
+#define BENCH_SAMPLES   100000
+#define BENCH_PHASE_N   5000        // 1 s @ 5 kHz
+// 글로벌 타이머는 CPU 클럭의 1/2 로 동작
+#define CYCLES_PER_TICK ((double)XPAR_CPU_CORTEXA9_0_CPU_CLK_FREQ_HZ / COUNTS_PER_SECOND)
+
+volatile s32 bench_sink;
+
+// 기존 sdcard_trajec.c 구현 (비교 기준)
+int quintic_trajectory(u32 t_ms, u32 T_ms, int q0, int qf) {
+    float tau = (float)t_ms / (float)T_ms;
+    if (tau < 0.0f) tau = 0.0f;
+    if (tau > 1.0f) tau = 1.0f;
+    float q = 6*tau*tau*tau*tau*tau
+            - 15*tau*tau*tau*tau
+            + 10*tau*tau*tau;
+    return q0 + (int)((qf - q0) * q);
+}
+
+static double ticks_to_cyc(XTime t0, XTime t1, int n_axes) {
+    return (double)(t1 - t0) * CYCLES_PER_TICK / ((double)BENCH_SAMPLES * n_axes);
+}
+
+static void bench_axes(int n_axes) {
+    s32 q0[TRAJ_MAX_AXES] = {0}, qf[TRAJ_MAX_AXES] = {0}, out[TRAJ_MAX_AXES];
+    for (int i = 0; i < n_axes; i++) { q0[i] = -1000 * i; qf[i] = 40000 + 1000 * i; }
+
+    XTime t0, t1;
+
+    // 1. float, 축별 호출
+    XTime_GetTime(&t0);
+    for (u32 k = 0; k < BENCH_SAMPLES; k++) {
+        u32 n = k % BENCH_PHASE_N;
+        for (int i = 0; i < n_axes; i++)
+            bench_sink = quintic_trajectory(n, BENCH_PHASE_N, q0[i], qf[i]);
+    }
+    XTime_GetTime(&t1);
+    double cyc_float = ticks_to_cyc(t0, t1, n_axes);
+
+    // 2. 고정소수점 Horner, 일괄 호출
+    traj_seg_t seg;
+    traj_seg_init(&seg, BENCH_PHASE_N, n_axes, q0, qf);
+    XTime_GetTime(&t0);
+    for (u32 k = 0; k < BENCH_SAMPLES; k++) {
+        traj_eval(&seg, k % BENCH_PHASE_N, out);
+        bench_sink = out[0];
+    }
+    XTime_GetTime(&t1);
+    double cyc_horner = ticks_to_cyc(t0, t1, n_axes);
+
+    // 3. forward differencing (재시드 비용 포함)
+    traj_profile_t prof;
+    traj_profile_init(&prof, n_axes, true);
+    traj_profile_add(&prof, BENCH_PHASE_N, q0, qf);
+    XTime_GetTime(&t0);
+    for (u32 k = 0; k < BENCH_SAMPLES; k++) {
+        if (!traj_profile_step(&prof, out)) {
+            traj_profile_rewind(&prof);
+            traj_profile_step(&prof, out);
+        }
+        bench_sink = out[0];
+    }
+    XTime_GetTime(&t1);
+    double cyc_fd = ticks_to_cyc(t0, t1, n_axes);
+
+    printf("%5d | %12.1f | %12.1f | %12.1f\n", n_axes, cyc_float, cyc_horner, cyc_fd);
+}
+
+int main() {
+    printf("\n======= Trajectory Kernel Benchmark =======\n");
+    printf("%d samples, N=%d, cycles per sample per axis\n", BENCH_SAMPLES, BENCH_PHASE_N);
+    printf("axes  |   float(ref) |  Q30 Horner  |   Q60 FD\n");
+    for (int n_axes = 1; n_axes <= TRAJ_MAX_AXES; n_axes++) bench_axes(n_axes);
+    printf("[OK] Benchmark done.\n");
+    return 0;
+}
@@ -0,0 +1,152 @@
+// trajectory.c: 고정소수점 quintic 트라젝토리 커널 구현
+
+#include <string.h>
+#include "trajectory.h"
+
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+#include <arm_neon.h>
+#define TRAJ_USE_NEON 1
+#endif
+
+#define TRAJ_ONE  (1LL << TRAJ_S_FRAC)
+
+// j! * S(k, j) (S: 제2종 스털링 수), 거듭제곱 계수 → 전방 차분 변환용
+static const s32 traj_fd_stirling[6][6] = {
+    { 1, 0, 0,   0,   0,   0 },
+    { 0, 1, 1,   1,   1,   1 },
+    { 0, 0, 2,   6,  14,  30 },
+    { 0, 0, 0,   6,  36, 150 },
+    { 0, 0, 0,   0,  24, 240 },
+    { 0, 0, 0,   0,   0, 120 },
+};
+
+void traj_seg_init(traj_seg_t *seg, u32 n_samples, int n_axes, const s32 *q0, const s32 *qf) {
+    memset(seg, 0, sizeof(*seg));
+    if (n_samples == 0) n_samples = 1;
+    if (n_axes > TRAJ_MAX_AXES) n_axes = TRAJ_MAX_AXES;
+
+    seg->n_samples = n_samples;
+    seg->tau_step = (1ULL << 62) / n_samples;
+    for (int i = 0; i < n_axes; i++) {
+        seg->q0[i] = q0[i];
+        seg->dq[i] = qf[i] - q0[i];
+    }
+}
+
+s32 traj_s_horner(const traj_seg_t *seg, u32 n) {
+    if (n >= seg->n_samples) return (s32)TRAJ_ONE;
+
+    // τ: Q2.30, 중간값 h: Q4.28 (|h| <= 15 이므로 h * τ 는 2^62 이내)
+    s64 t = (s64)(((u64)n * seg->tau_step) >> 32);
+    s64 h = ((6 * t) >> 2) - (15LL << 28);
+    h = ((h * t + (1LL << 29)) >> 30) + (10LL << 28);
+    h = (h * t + (1LL << 29)) >> 30;
+    h = (h * t + (1LL << 29)) >> 30;
+    h = (h * t + (1LL << 27)) >> 28;        // Q4.28 * Q2.30 → Q2.30
+    return (s32)h;
+}
+
+void traj_fd_seed(traj_seg_t *seg, u32 n) {
+    // τ0 에서의 테일러 계수 c_k = s^(k)(τ0) / k! / N^k 를 구해 전방 차분으로 변환.
+    // 재시드 시에만 double 을 쓰고, 샘플 간 갱신은 64비트 정수 덧셈 5회.
+    double N = (double)seg->n_samples;
+    double t = (double)n / N;
+    double c[6];
+    c[0] = t * t * t * (10.0 + t * (-15.0 + 6.0 * t));
+    c[1] = t * t * (30.0 + t * (-60.0 + 30.0 * t)) / N;
+    c[2] = t * (30.0 + t * (-90.0 + 60.0 * t)) / (N * N);
+    c[3] = (10.0 + t * (-60.0 + 60.0 * t)) / (N * N * N);
+    c[4] = (-15.0 + 30.0 * t) / (N * N * N * N);
+    c[5] = 6.0 / (N * N * N * N * N);
+
+    for (int j = 0; j < 6; j++) {
+        double d = 0.0;
+        for (int k = j; k < 6; k++) d += c[k] * traj_fd_stirling[j][k];
+        d *= (double)(1ULL << TRAJ_FD_FRAC);
+        seg->fd[j] = (s64)(d < 0.0 ? d - 0.5 : d + 0.5);
+    }
+    seg->fd_n = n;
+}
+
+s32 traj_fd_next(traj_seg_t *seg) {
+    u32 n = seg->fd_n;
+    if (n >= seg->n_samples) return (s32)TRAJ_ONE;
+
+    s32 s = (s32)((seg->fd[0] + (1LL << (TRAJ_FD_FRAC - TRAJ_S_FRAC - 1))) >> (TRAJ_FD_FRAC - TRAJ_S_FRAC));
+
+    // 반올림 누적 오차는 샘플 수의 5제곱으로 자라므로 블록마다 재시드
+    if (((n + 1) % TRAJ_FD_BLOCK) == 0) {
+        traj_fd_seed(seg, n + 1);
+    } else {
+        seg->fd[0] += seg->fd[1];
+        seg->fd[1] += seg->fd[2];
+        seg->fd[2] += seg->fd[3];
+        seg->fd[3] += seg->fd[4];
+        seg->fd[4] += seg->fd[5];
+        seg->fd_n = n + 1;
+    }
+    return s;
+}
+
+void traj_apply_axes(const traj_seg_t *seg, s32 s_q30, s32 *out) {
+#ifdef TRAJ_USE_NEON
+    int32x2_t s = vdup_n_s32(s_q30);
+    for (int i = 0; i < TRAJ_MAX_AXES; i += 4) {
+        int32x4_t dq = vld1q_s32(&seg->dq[i]);
+        int32x4_t q0 = vld1q_s32(&seg->q0[i]);
+        int32x2_t lo = vrshrn_n_s64(vmull_s32(vget_low_s32(dq), s), TRAJ_S_FRAC);
+        int32x2_t hi = vrshrn_n_s64(vmull_s32(vget_high_s32(dq), s), TRAJ_S_FRAC);
+        vst1q_s32(&out[i], vaddq_s32(q0, vcombine_s32(lo, hi)));
+    }
+#else
+    for (int i = 0; i < TRAJ_MAX_AXES; i++) {
+        s64 p = (s64)seg->dq[i] * s_q30;
+        out[i] = seg->q0[i] + (s32)((p + (1LL << (TRAJ_S_FRAC - 1))) >> TRAJ_S_FRAC);
+    }
+#endif
+}
+
+void traj_profile_init(traj_profile_t *p, int n_axes, bool use_fd) {
+    memset(p, 0, sizeof(*p));
+    if (n_axes < 0) n_axes = 0;
+    if (n_axes > TRAJ_MAX_AXES) n_axes = TRAJ_MAX_AXES;
+    p->n_axes = n_axes;
+    p->use_fd = use_fd;
+}
+
+int traj_profile_add(traj_profile_t *p, u32 n_samples, const s32 *q0, const s32 *qf) {
+    if (p->n_segs >= TRAJ_MAX_SEGS) return -1;
+    traj_seg_init(&p->seg[p->n_segs], n_samples, p->n_axes, q0, qf);
+    p->n_segs++;
+    traj_profile_rewind(p);
+    return 0;
+}
+
+void traj_profile_rewind(traj_profile_t *p) {
+    p->cur = 0;
+    p->n = 0;
+    if (p->use_fd && p->n_segs > 0) traj_fd_seed(&p->seg[0], 1);
+}
+
+u32 traj_profile_length(const traj_profile_t *p) {
+    u32 total = 0;
+    for (int i = 0; i < p->n_segs; i++) total += p->seg[i].n_samples;
+    return total;
+}
+
+// 각 구간은 n = 1..N 을 출력 (구간 끝점 = 다음 구간 시작점이 중복되지 않음)
+bool traj_profile_step(traj_profile_t *p, s32 *out) {
+    if (p->cur >= p->n_segs) return false;
+
+    traj_seg_t *seg = &p->seg[p->cur];
+    p->n++;
+    s32 s = p->use_fd ? traj_fd_next(seg) : traj_s_horner(seg, p->n);
+    traj_apply_axes(seg, s, out);
+
+    if (p->n >= seg->n_samples) {
+        p->cur++;
+        p->n = 0;
+        if (p->use_fd && p->cur < p->n_segs) traj_fd_seed(&p->seg[p->cur], 1);
+    }
+    return true;
+}
@@ -0,0 +1,67 @@
+// trajectory.h: 고정소수점 quintic 트라젝토리 커널 (다축 일괄 평가)
+//
+// 정규화 궤적 s(τ) = 10τ³ - 15τ⁴ + 6τ⁵ 는 같은 구간의 모든 축이 공유하므로
+// 틱마다 s(τ)를 한 번만 (Horner 또는 forward differencing으로) 계산하고,
+// 축별로는 q = q0 + dq * s 곱셈 한 번만 수행한다 (NEON vmull 4-lane).
+// 축이 늘어나도 틱당 PS 비용은 거의 일정하다.
+// 정밀도: s 오차 약 2^-28, 이동량 2^22 카운트 이하에서 ±0.5 카운트 (반올림 수준).
+
+#ifndef TRAJECTORY_H
+#define TRAJECTORY_H
+
+#include <stdbool.h>
+#include "xil_types.h"
+
+#define TRAJ_MAX_AXES   4       // 4의 배수 (NEON 4-lane 단위로 처리)
+#define TRAJ_MAX_SEGS   4       // 프로파일 당 최대 구간 수
+#define TRAJ_S_FRAC     30      // s(τ), τ 포맷: Q2.30
+#define TRAJ_FD_FRAC    60      // forward differencing 상태 포맷: Q3.60
+#define TRAJ_FD_BLOCK   256     // FD 재시드 주기 (샘플), 누적 오차 < 1e-8
+
+// 한 구간 (모든 축이 같은 샘플 수 N 으로 q0 → qf 이동)
+typedef struct {
+    u32 n_samples;              // 구간 샘플 수 N (τ = n / N)
+    u64 tau_step;               // 2^62 / N, τ(n) = (n * tau_step) >> 32 (Q2.30)
+    s32 q0[TRAJ_MAX_AXES];      // 축별 시작 위치
+    s32 dq[TRAJ_MAX_AXES];      // 축별 이동량 qf - q0 (미사용 축은 0)
+
+    // forward differencing 상태 (정규화 s(n), Q3.60)
+    s64 fd[6];
+    u32 fd_n;                   // fd[0] 이 나타내는 샘플 인덱스
+} traj_seg_t;
+
+// 연속 구간 프로파일 (예: 정방향 → 복귀)
+typedef struct {
+    int n_axes;
+    int n_segs;
+    traj_seg_t seg[TRAJ_MAX_SEGS];
+    bool use_fd;                // true: forward differencing, false: 매 샘플 Horner
+    int cur;                    // 현재 구간
+    u32 n;                      // 현재 구간 내 샘플 인덱스
+} traj_profile_t;
+
+// 구간 계수 사전 계산 (n_samples >= 1, |qf - q0| < 2^31)
+void traj_seg_init(traj_seg_t *seg, u32 n_samples, int n_axes, const s32 *q0, const s32 *qf);
+
+// s(n / N) 를 Q2.30 으로 계산 (Horner, 64비트 정수 연산만 사용)
+s32 traj_s_horner(const traj_seg_t *seg, u32 n);
+
+// forward differencing: n 에서 차분표 시드 후 샘플마다 s 를 하나씩 생성
+void traj_fd_seed(traj_seg_t *seg, u32 n);
+s32 traj_fd_next(traj_seg_t *seg);
+
+// 모든 축 일괄 적용: out[i] = q0[i] + round(dq[i] * s)
+void traj_apply_axes(const traj_seg_t *seg, s32 s_q30, s32 *out);
+
+static inline void traj_eval(const traj_seg_t *seg, u32 n, s32 *out) {
+    traj_apply_axes(seg, traj_s_horner(seg, n), out);
+}
+
+// 프로파일: 구간 추가 후 틱마다 traj_profile_step() 호출
+void traj_profile_init(traj_profile_t *p, int n_axes, bool use_fd);
+int traj_profile_add(traj_profile_t *p, u32 n_samples, const s32 *q0, const s32 *qf);
+void traj_profile_rewind(traj_profile_t *p);
+u32 traj_profile_length(const traj_profile_t *p);
+bool traj_profile_step(traj_profile_t *p, s32 *out);   // 끝나면 false
+
+#endif
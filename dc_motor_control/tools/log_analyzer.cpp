@@ -0,0 +1,491 @@
+// log_analyzer.cpp: SD 로그 (LOGxx.CSV / log_NN.csv / CAPxx.BIN) 일괄 분석 도구 (호스트용)
+//
+// 지원 포맷 (CSV 는 헤더로 자동 판별)
+//   2축 : Time_ms,Delta_ms,Kp,Ki,Kd,Des1,Act1,Err1,Des2,Act2,Err2
+//   1축 : Time_ms,Delta_ms,Kp,Ki,Kd,Desired,Actual,Error
+//   .bin : mode 6 DMA 캡처 (vitis/tlm_dma.h tlm_frame_t 배열, 리틀 엔디언 48 B/프레임).
+//          시간은 frame_count x 제어 틱 (50 us), 게인은 기록되지 않으므로 0.
+//
+// 파일은 mmap 후 한 번에 파싱하여 열 단위(SoA) 배열로 만들고, 지표 계산은 자동 벡터화가
+// 가능한 단순 루프로 수행한다. 여러 파일은 코어 수만큼 스레드로 나눠 처리한다.
+// 한 파일 안에 여러 번의 실행이 이어 기록된 경우 Delta_ms 가 --split-gap 보다 크면 새 실행으로 본다.
+//
+// 출력 (실행 x 축 당 한 줄, CSV)
+//   file,run,axis,kp,ki,kd,samples,duration_ms,step,rise_ms,overshoot_pct,settle_ms,
+//   iae,itae,max_err,rms_err,dt_mean_ms,dt_std_ms,dt_max_ms,dt_zero
+//
+// 빌드: g++ -O3 -march=native -std=c++17 -pthread log_analyzer.cpp -o log_analyzer
+// 사용: log_analyzer [--sort itae|iae|max_err|overshoot_pct|settle_ms|rise_ms] [--band PCT]
+//                    [--split-gap MS] [--threads N] [-o out.csv] <file|dir>...
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace fs = std::filesystem;
+
+struct options {
+    std::string sort_key;
+    std::string out_path;
+    double band_pct = 2.0;          // settling 허용 폭 (% of step)
+    double split_gap_ms = 100.0;    // 실행 분리 기준
+    unsigned threads = 0;
+};
+
+// 실행 x 축 요약
+struct summary {
+    std::string file;
+    int run = 0;
+    int axis = 0;
+    double kp = 0, ki = 0, kd = 0;
+    size_t samples = 0;
+    double duration_ms = 0;
+    double step = 0;
+    double rise_ms = NAN;
+    double overshoot_pct = 0;
+    double settle_ms = NAN;
+    double iae = 0, itae = 0;
+    double max_err = 0, rms_err = 0;
+    double dt_mean = 0, dt_std = 0, dt_max = 0;
+    size_t dt_zero = 0;
+};
+
+// 한 실행의 열 데이터 (SoA)
+struct run_data {
+    std::vector<double> t, dt;
+    double kp = 0, ki = 0, kd = 0;
+    std::vector<std::vector<double>> des, act;
+};
+
+// ---------------------------------------------------------------- 파서
+
+struct mapped_file {
+    const char *data = nullptr;
+    size_t size = 0;
+    int fd = -1;
+
+    explicit mapped_file(const std::string &path) {
+        fd = ::open(path.c_str(), O_RDONLY);
+        if (fd < 0) return;
+        struct stat st;
+        if (fstat(fd, &st) != 0 || st.st_size == 0) return;
+        size = (size_t)st.st_size;
+        void *p = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (p == MAP_FAILED) { size = 0; return; }
+        madvise(p, size, MADV_SEQUENTIAL);
+        data = (const char *)p;
+    }
+    ~mapped_file() {
+        if (data) munmap((void *)data, size);
+        if (fd >= 0) ::close(fd);
+    }
+};
+
+// 부호 / 정수부 / 소수부만 처리하는 빠른 실수 파서 (로그에는 지수 표기가 없음)
+static inline const char *parse_num(const char *p, const char *end, double *out) {
+    bool neg = false;
+    if (p < end && (*p == '-' || *p == '+')) { neg = (*p == '-'); p++; }
+    long long ip = 0;
+    while (p < end && (unsigned)(*p - '0') < 10) ip = ip * 10 + (*p++ - '0');
+    double v = (double)ip;
+    if (p < end && *p == '.') {
+        p++;
+        long long fp = 0;
+        double scale = 1.0;
+        while (p < end && (unsigned)(*p - '0') < 10) { fp = fp * 10 + (*p++ - '0'); scale *= 10.0; }
+        v += (double)fp / scale;
+    }
+    *out = neg ? -v : v;
+    return p;
+}
+
+struct column_map {
+    int time = -1, delta = -1, kp = -1, ki = -1, kd = -1;
+    std::vector<int> des, act;      // 축 순서
+    int n_cols = 0;
+};
+
+static bool parse_header(const std::string &line, column_map *cm) {
+    std::vector<std::string> names;
+    size_t pos = 0;
+    while (pos <= line.size()) {
+        size_t c = line.find(',', pos);
+        if (c == std::string::npos) c = line.size();
+        std::string n = line.substr(pos, c - pos);
+        while (!n.empty() && (n.back() == '\r' || n.back() == ' ')) n.pop_back();
+        names.push_back(n);
+        pos = c + 1;
+    }
+    cm->n_cols = (int)names.size();
+    for (int i = 0; i < cm->n_cols; i++) {
+        const std::string &n = names[i];
+        if (n == "Time_ms") cm->time = i;
+        else if (n == "Delta_ms") cm->delta = i;
+        else if (n == "Kp") cm->kp = i;
+        else if (n == "Ki") cm->ki = i;
+        else if (n == "Kd") cm->kd = i;
+        else if (n == "Desired") cm->des.assign(1, i);
+        else if (n == "Actual") cm->act.assign(1, i);
+        else if (n.rfind("Des", 0) == 0 && n.size() > 3) {
+            size_t a = (size_t)std::atoi(n.c_str() + 3);
+            if (a >= 1) { if (cm->des.size() < a) cm->des.resize(a, -1); cm->des[a - 1] = i; }
+        } else if (n.rfind("Act", 0) == 0 && n.size() > 3) {
+            size_t a = (size_t)std::atoi(n.c_str() + 3);
+            if (a >= 1) { if (cm->act.size() < a) cm->act.resize(a, -1); cm->act[a - 1] = i; }
+        }
+    }
+    if (cm->time < 0 || cm->des.empty() || cm->des.size() != cm->act.size()) return false;
+    for (size_t a = 0; a < cm->des.size(); a++)
+        if (cm->des[a] < 0 || cm->act[a] < 0) return false;
+    return true;
+}
+
+static std::vector<run_data> load_runs(const std::string &path, const options &opt) {
+    std::vector<run_data> runs;
+    mapped_file mf(path);
+    if (!mf.data) return runs;
+
+    const char *p = mf.data;
+    const char *end = mf.data + mf.size;
+    const char *eol = (const char *)memchr(p, '\n', (size_t)(end - p));
+    if (!eol) return runs;
+
+    column_map cm;
+    if (!parse_header(std::string(p, (size_t)(eol - p)), &cm)) {
+        fprintf(stderr, "[WARN] %s: unknown header, skipped\n", path.c_str());
+        return runs;
+    }
+    p = eol + 1;
+
+    const size_t n_axes = cm.des.size();
+    const size_t est = mf.size / 40 + 1;
+    std::vector<double> row((size_t)cm.n_cols);
+    run_data *cur = nullptr;
+    double prev_t = 0;
+
+    while (p < end) {
+        const char *line_end = (const char *)memchr(p, '\n', (size_t)(end - p));
+        if (!line_end) line_end = end;
+
+        // 헤더 재등장 (로그 리셋 후) 또는 빈 줄은 건너뜀
+        if ((unsigned)(*p - '0') >= 10 && *p != '-' && *p != '+') { p = line_end + 1; cur = nullptr; continue; }
+
+        int col = 0;
+        const char *q = p;
+        while (q < line_end && col < cm.n_cols) {
+            q = parse_num(q, line_end, &row[(size_t)col]);
+            while (q < line_end && *q != ',') q++;
+            if (q < line_end) q++;
+            col++;
+        }
+        p = line_end + 1;
+        if (col < cm.n_cols) continue;      // 잘린 줄 (전원 차단 등)
+
+        double t = row[(size_t)cm.time];
+        double dt = cm.delta >= 0 ? row[(size_t)cm.delta] : (cur ? t - prev_t : 0.0);
+        if (!cur || dt > opt.split_gap_ms || t < prev_t) {
+            runs.emplace_back();
+            cur = &runs.back();
+            cur->des.resize(n_axes);
+            cur->act.resize(n_axes);
+            cur->t.reserve(est); cur->dt.reserve(est);
+            for (size_t a = 0; a < n_axes; a++) { cur->des[a].reserve(est); cur->act[a].reserve(est); }
+            dt = 0.0;
+        }
+        cur->t.push_back(t);
+        cur->dt.push_back(dt);
+        if (cm.kp >= 0) cur->kp = row[(size_t)cm.kp];
+        if (cm.ki >= 0) cur->ki = row[(size_t)cm.ki];
+        if (cm.kd >= 0) cur->kd = row[(size_t)cm.kd];
+        for (size_t a = 0; a < n_axes; a++) {
+            cur->des[a].push_back(row[(size_t)cm.des[a]]);
+            cur->act[a].push_back(row[(size_t)cm.act[a]]);
+        }
+        prev_t = t;
+    }
+    return runs;
+}
+
+// tlm_frame_t (vitis/tlm_dma.h) 와 같은 배치
+constexpr size_t BIN_AXES = 2;
+constexpr size_t BIN_FRAME_WORDS = 1 + 5 * BIN_AXES + 1;
+constexpr double BIN_TICK_MS = 0.05;        // 20 kHz 제어 틱
+
+static inline uint32_t load_le32(const unsigned char *p) {
+    return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+static std::vector<run_data> load_runs_bin(const std::string &path, const options &opt) {
+    std::vector<run_data> runs;
+    mapped_file mf(path);
+    if (!mf.data) return runs;
+
+    const size_t frame_bytes = BIN_FRAME_WORDS * 4;
+    const size_t n = mf.size / frame_bytes;     // 끝의 잘린 프레임은 무시
+    if (mf.size % frame_bytes)
+        fprintf(stderr, "[WARN] %s: trailing %zu bytes ignored\n", path.c_str(), mf.size % frame_bytes);
+
+    const unsigned char *p = (const unsigned char *)mf.data;
+    run_data *cur = nullptr;
+    uint32_t prev_fc = 0;
+    uint64_t ticks = 0;                         // 실행 시작부터 틱 수 (frame_count 랩어라운드 포함)
+
+    for (size_t k = 0; k < n; k++, p += frame_bytes) {
+        const uint32_t fc = load_le32(p);
+        const uint32_t gap = fc - prev_fc;      // 드롭된 프레임이 있으면 > 1
+        const double dt = cur ? gap * BIN_TICK_MS : 0.0;
+        // frame_count 가 되돌아가면 (PL 리셋) 또는 간격이 split-gap 보다 크면 새 실행
+        if (!cur || gap > 0x80000000u || dt > opt.split_gap_ms) {
+            runs.emplace_back();
+            cur = &runs.back();
+            cur->des.resize(BIN_AXES);
+            cur->act.resize(BIN_AXES);
+            const size_t est = n - k;
+            cur->t.reserve(est); cur->dt.reserve(est);
+            for (size_t a = 0; a < BIN_AXES; a++) { cur->des[a].reserve(est); cur->act[a].reserve(est); }
+            ticks = 0;
+            cur->t.push_back(0.0);
+            cur->dt.push_back(0.0);
+        } else {
+            ticks += gap;
+            cur->t.push_back((double)ticks * BIN_TICK_MS);
+            cur->dt.push_back(dt);
+        }
+        for (size_t a = 0; a < BIN_AXES; a++) {
+            cur->des[a].push_back((double)(int32_t)load_le32(p + 4 * (1 + 5 * a)));
+            cur->act[a].push_back((double)(int32_t)load_le32(p + 4 * (1 + 5 * a + 1)));
+        }
+        prev_fc = fc;
+    }
+    return runs;
+}
+
+// ---------------------------------------------------------------- 지표
+
+static void timing_stats(const run_data &r, summary *s) {
+    const size_t n = r.dt.size();
+    if (n < 2) return;
+    const double *dt = r.dt.data();
+    double sum = 0, sum2 = 0, mx = 0;
+    size_t zero = 0;
+    for (size_t i = 1; i < n; i++) {
+        sum += dt[i];
+        sum2 += dt[i] * dt[i];
+        mx = std::max(mx, dt[i]);
+        zero += (dt[i] == 0.0);
+    }
+    const double m = sum / (double)(n - 1);
+    s->dt_mean = m;
+    s->dt_std = std::sqrt(std::max(0.0, sum2 / (double)(n - 1) - m * m));
+    s->dt_max = mx;
+    s->dt_zero = zero;
+}
+
+static void axis_metrics(const run_data &r, size_t a, const options &opt, summary *s) {
+    const size_t n = r.t.size();
+    const double *t = r.t.data();
+    const double *d = r.des[a].data();
+    const double *y = r.act[a].data();
+    const double t0 = t[0];
+
+    // 추종 오차 적분 (전 구간), 직사각형 적분
+    double iae = 0, itae = 0, sq = 0, mx = 0;
+    for (size_t i = 1; i < n; i++) {
+        const double e = std::fabs(d[i] - y[i]);
+        const double h = (t[i] - t[i - 1]) * 1e-3;
+        iae += e * h;
+        itae += (t[i] - t0) * 1e-3 * e * h;
+        sq += e * e;
+        mx = std::max(mx, e);
+    }
+    s->iae = iae;
+    s->itae = itae;
+    s->max_err = std::max(mx, std::fabs(d[0] - y[0]));
+    s->rms_err = std::sqrt(sq / (double)std::max<size_t>(1, n - 1));
+
+    // 스텝 지표: 목표가 시작값에서 가장 멀어진 지점을 목표값으로 보고,
+    // 목표가 그 값을 떠나기 전까지를 응답 구간으로 사용 (정방향 → 복귀 트라젝토리 대응)
+    const double y0 = y[0];
+    size_t i_peak = 0;
+    double far = 0;
+    for (size_t i = 0; i < n; i++) {
+        const double v = std::fabs(d[i] - d[0]);
+        if (v > far) { far = v; i_peak = i; }
+    }
+    const double target = d[i_peak];
+    const double step = target - y0;
+    s->step = step;
+    if (std::fabs(step) < 1.0) return;
+
+    size_t i_end = i_peak;
+    while (i_end + 1 < n && d[i_end + 1] == target) i_end++;
+
+    // 이동 시작: 목표가 처음 변한 시점
+    size_t i_start = 0;
+    while (i_start < i_peak && d[i_start] == d[0]) i_start++;
+    if (i_start > 0) i_start--;
+    const double ts = t[i_start];
+
+    const double sgn = step > 0 ? 1.0 : -1.0;
+    const double lo = y0 + 0.1 * step, hi = y0 + 0.9 * step;
+    double t10 = NAN, t90 = NAN, peak = 0;
+    for (size_t i = i_start; i <= i_end; i++) {
+        const double v = sgn * y[i];
+        if (std::isnan(t10) && v >= sgn * lo) t10 = t[i];
+        if (std::isnan(t90) && v >= sgn * hi) t90 = t[i];
+        peak = std::max(peak, v - sgn * target);
+    }
+    s->rise_ms = t90 - t10;
+    s->overshoot_pct = 100.0 * peak / std::fabs(step);
+
+    const double band = std::max(1.0, std::fabs(step) * opt.band_pct / 100.0);
+    size_t last_out = i_start;
+    bool settled = std::fabs(y[i_end] - target) <= band;
+    for (size_t i = i_start; i <= i_end; i++)
+        if (std::fabs(y[i] - target) > band) last_out = i;
+    if (settled && last_out < i_end) s->settle_ms = t[last_out + 1] - ts;
+}
+
+static bool is_bin_file(const fs::path &p) {
+    std::string ext = p.extension().string();
+    for (char &c : ext) c = (char)std::tolower((unsigned char)c);
+    return ext == ".bin";
+}
+
+static void analyze_file(const std::string &path, const options &opt, std::vector<summary> *out) {
+    std::vector<run_data> runs = is_bin_file(path) ? load_runs_bin(path, opt) : load_runs(path, opt);
+    for (size_t k = 0; k < runs.size(); k++) {
+        const run_data &r = runs[k];
+        if (r.t.size() < 2) continue;
+        summary base;
+        base.file = path;
+        base.run = (int)k;
+        base.kp = r.kp; base.ki = r.ki; base.kd = r.kd;
+        base.samples = r.t.size();
+        base.duration_ms = r.t.back() - r.t.front();
+        timing_stats(r, &base);
+        for (size_t a = 0; a < r.des.size(); a++) {
+            summary s = base;
+            s.axis = (int)a + 1;
+            axis_metrics(r, a, opt, &s);
+            out->push_back(s);
+        }
+    }
+}
+
+// ---------------------------------------------------------------- 출력
+
+static double sort_value(const summary &s, const std::string &key) {
+    if (key == "iae") return s.iae;
+    if (key == "itae") return s.itae;
+    if (key == "max_err") return s.max_err;
+    if (key == "rms_err") return s.rms_err;
+    if (key == "overshoot_pct") return s.overshoot_pct;
+    if (key == "settle_ms") return std::isnan(s.settle_ms) ? INFINITY : s.settle_ms;
+    if (key == "rise_ms") return std::isnan(s.rise_ms) ? INFINITY : s.rise_ms;
+    if (key == "dt_std_ms") return s.dt_std;
+    return 0.0;
+}
+
+static void print_table(FILE *fp, const std::vector<summary> &rows) {
+    fprintf(fp, "file,run,axis,kp,ki,kd,samples,duration_ms,step,rise_ms,overshoot_pct,settle_ms,"
+                "iae,itae,max_err,rms_err,dt_mean_ms,dt_std_ms,dt_max_ms,dt_zero\n");
+    for (const summary &s : rows) {
+        fprintf(fp, "%s,%d,%d,%.3f,%.3f,%.3f,%zu,%.3f,%.0f,%.3f,%.2f,%.3f,%.4g,%.4g,%.0f,%.2f,%.4f,%.4f,%.3f,%zu\n",
+                s.file.c_str(), s.run, s.axis, s.kp, s.ki, s.kd, s.samples, s.duration_ms, s.step,
+                s.rise_ms, s.overshoot_pct, s.settle_ms, s.iae, s.itae, s.max_err, s.rms_err,
+                s.dt_mean, s.dt_std, s.dt_max, s.dt_zero);
+    }
+}
+
+static bool is_log_file(const fs::path &p) {
+    std::string ext = p.extension().string();
+    for (char &c : ext) c = (char)std::tolower((unsigned char)c);
+    return ext == ".csv" || ext == ".bin";
+}
+
+static void usage() {
+    fprintf(stderr, "usage: log_analyzer [--sort KEY] [--band PCT] [--split-gap MS] [--threads N] [-o out.csv] <file|dir>...\n"
+                    "  KEY: itae | iae | max_err | rms_err | overshoot_pct | settle_ms | rise_ms | dt_std_ms\n");
+}
+
+int main(int argc, char **argv) {
+    options opt;
+    std::vector<std::string> files;
+
+    for (int i = 1; i < argc; i++) {
+        std::string a = argv[i];
+        auto next = [&]() -> const char * {
+            if (i + 1 >= argc) { usage(); exit(1); }
+            return argv[++i];
+        };
+        if (a == "--sort") opt.sort_key = next();
+        else if (a == "--band") opt.band_pct = atof(next());
+        else if (a == "--split-gap") opt.split_gap_ms = atof(next());
+        else if (a == "--threads") opt.threads = (unsigned)atoi(next());
+        else if (a == "-o") opt.out_path = next();
+        else if (a == "-h" || a == "--help") { usage(); return 0; }
+        else if (fs::is_directory(a)) {
+            for (const auto &e : fs::recursive_directory_iterator(a))
+                if (e.is_regular_file() && is_log_file(e.path())) files.push_back(e.path().string());
+        } else {
+            files.push_back(a);
+        }
+    }
+    if (files.empty()) { usage(); return 1; }
+    std::sort(files.begin(), files.end());
+
+    // 큰 파일부터 처리해 스레드 간 부하 균형
+    std::vector<size_t> order(files.size());
+    std::vector<uintmax_t> sizes(files.size());
+    for (size_t i = 0; i < files.size(); i++) {
+        order[i] = i;
+        std::error_code ec;
+        sizes[i] = fs::file_size(files[i], ec);
+    }
+    std::sort(order.begin(), order.end(), [&](size_t x, size_t y) { return sizes[x] > sizes[y]; });
+
+    unsigned n_threads = opt.threads ? opt.threads : std::max(1u, std::thread::hardware_concurrency());
+    n_threads = std::min<unsigned>(n_threads, (unsigned)files.size());
+
+    std::vector<std::vector<summary>> per_file(files.size());
+    std::atomic<size_t> next_job{0};
+    std::vector<std::thread> pool;
+    for (unsigned w = 0; w < n_threads; w++) {
+        pool.emplace_back([&]() {
+            for (size_t j; (j = next_job.fetch_add(1)) < order.size();)
+                analyze_file(files[order[j]], opt, &per_file[order[j]]);
+        });
+    }
+    for (std::thread &th : pool) th.join();
+
+    std::vector<summary> rows;
+    for (auto &v : per_file) rows.insert(rows.end(), v.begin(), v.end());
+    if (!opt.sort_key.empty())
+        std::stable_sort(rows.begin(), rows.end(), [&](const summary &x, const summary &y) {
+            return sort_value(x, opt.sort_key) < sort_value(y, opt.sort_key);
+        });
+
+    FILE *fp = stdout;
+    if (!opt.out_path.empty() && !(fp = fopen(opt.out_path.c_str(), "w"))) {
+        fprintf(stderr, "[ERR] cannot open %s\n", opt.out_path.c_str());
+        return 1;
+    }
+    print_table(fp, rows);
+    if (fp != stdout) fclose(fp);
+
+    fprintf(stderr, "[OK] %zu files, %zu rows, %u threads\n", files.size(), rows.size(), n_threads);
+    return 0;
+}
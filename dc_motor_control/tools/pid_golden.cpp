@@ -0,0 +1,345 @@
+// pid_golden.cpp: pi_velocity_controller 골든 모델 도구 (호스트용, 모델은 pid_golden.hpp)
+//
+// 모드
+//   selftest : 무작위 입력 (래핑 / 포화 / 적분 제한 / 감쇠 구간 / 음수 게인 포함) 으로 일괄 모델과
+//              스칼라 기준 구현을 매 틱 비트 단위 비교하고 처리 속도를 잰다.
+//   vectors  : RTL 등가성 시험 벡터 생성. 한 줄에 한 틱 (16진수):
+//                rst kp ki kd desired actual expected_control expected_error
+//              rst = 1 이면 그 틱 전에 reset_n. tb_pid_pos_equiv.v 가 읽어 RTL 출력과 비교한다.
+//              expected_error 는 tlm_error (이번 틱 desired_ff - actual_ff).
+//   sweep    : 게인 x 관성 격자의 폐루프 스텝 응답을 lane 당 하나씩 동시에 시뮬레이션 (모터 모델은
+//              vitis/plant_sim.c 와 같은 식), 시나리오마다 지표 한 줄 (CSV).
+//
+// 빌드: g++ -O3 -march=native -std=c++17 -pthread pid_golden.cpp -o pid_golden
+// 사용: pid_golden selftest [--lanes N] [--ticks T] [--seed S] [--fuzzy] [--threads N]
+//       pid_golden vectors [--scenarios N] [--ticks T] [--seed S] [--fuzzy] [-o vec.hex]
+//       pid_golden sweep [--kp A:B:N] [--ki A:B:N] [--kd A:B:N] [--inertia A:B:N] [--step COUNTS]
+//                        [--ms MS] [--fuzzy] [--threads N] [-o out.csv]
+//
+// RTL 등가성 (Pid_pos.v, Pid_pos_fuzzy.v 는 --fuzzy 벡터로):
+//   pid_golden vectors -o pid_vectors.hex
+//   iverilog -o tb ../pid_pos_control_2axis/tb_pid_pos_equiv.v ../pid_pos_control_2axis/Pid_pos.v
+//   vvp tb +vec=pid_vectors.hex
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "pid_golden.hpp"
+
+using pid_golden::batch;
+using pid_golden::variant;
+
+static constexpr double TICK_HZ = 20000.0;     // Pid_pos.v DIVIDER = 5000 @ 100 MHz
+static constexpr int SUBSTEPS = 4;             // plant_sim.c PLANT_SUBSTEPS
+
+struct options {
+    std::string out_path;
+    size_t lanes = 4096;
+    size_t ticks = 20000;
+    size_t scenarios = 64;
+    unsigned seed = 1;
+    unsigned threads = 0;
+    variant var = variant::pos;
+    double step = 2000;
+    double ms = 500;
+    std::string kp = "0.5:4:8", ki = "0:0.1:4", kd = "0:16:5", inertia = "1:1:1";
+};
+
+// "A:B:N" (N 점 등간격) 또는 "A" → 값 목록
+static std::vector<double> parse_range(const std::string &s) {
+    double a = 0, b = 0;
+    int n = 1;
+    if (sscanf(s.c_str(), "%lf:%lf:%d", &a, &b, &n) == 3 && n > 1) {
+        std::vector<double> v(n);
+        for (int k = 0; k < n; k++) v[k] = a + (b - a) * k / (n - 1);
+        return v;
+    }
+    return { atof(s.c_str()) };
+}
+
+// vitis float_to_q78 과 같은 변환 (0 ~ 127.996, 버림)
+static uint16_t q78(double g) {
+    if (g < 0.0) g = 0.0;
+    if (g > 127.996) g = 127.996;
+    return (uint16_t)((int)(g * 256.0) & 0x7FFF);
+}
+
+// ---------------------------------------------------------------- 모터 (SoA, plant_sim.c motor_step 과 같은 식)
+
+struct plant_batch {
+    std::vector<float> supply_v, r_ohm, l_h, kt, j, b, tc, counts_per_rad;
+    std::vector<float> theta, omega, cur;
+    std::vector<int32_t> encoder;
+
+    explicit plant_batch(size_t n) {
+        for (auto *c : { &supply_v, &r_ohm, &l_h, &kt, &j, &b, &tc, &counts_per_rad, &theta, &omega, &cur })
+            c->assign(n, 0.0f);
+        encoder.assign(n, 0);
+        for (size_t k = 0; k < n; k++) {
+            // plant_param_default(): maxon DC 모터 + 512 CPR 엔코더 (x4)
+            supply_v[k] = 24.0f; r_ohm[k] = 2.0f; l_h[k] = 0.2e-3f; kt[k] = 0.03f;
+            j[k] = 2.0e-5f; b[k] = 2.0e-6f; tc[k] = 2.0e-3f; counts_per_rad[k] = 2048.0f / 6.2831853f;
+        }
+    }
+
+    void step(const int16_t *__restrict control, size_t lo, size_t hi) {
+        const float h = (float)(1.0 / (TICK_HZ * SUBSTEPS));
+        for (size_t k = lo; k < hi; k++) {
+            float v = supply_v[k] * (float)control[k] / pid_golden::CTRL_LIMIT;
+            float c = cur[k], w = omega[k], th = theta[k];
+            for (int s = 0; s < SUBSTEPS; s++) {
+                c += h * (v - r_ohm[k] * c - kt[k] * w) / l_h[k];
+                float tq = kt[k] * c - b[k] * w;
+                bool moving = std::fabs(w) > 1e-3f;
+                bool breakaway = std::fabs(tq) > tc[k];
+                float fr = moving ? (w > 0.0f ? tc[k] : -tc[k]) : (tq > 0.0f ? tc[k] : -tc[k]);
+                tq = (moving || breakaway) ? tq - fr : 0.0f;
+                w = (moving || breakaway) ? w : 0.0f;
+                w += h * tq / j[k];
+                th += h * w;
+            }
+            cur[k] = c; omega[k] = w; theta[k] = th;
+            float pos = th * counts_per_rad[k];
+            encoder[k] = (int32_t)(pos < 0.0f ? pos - 0.5f : pos + 0.5f);
+        }
+    }
+};
+
+// ---------------------------------------------------------------- selftest
+
+static bool same_state(const pid_golden::state &a, const pid_golden::state &b) {
+    return a.desired_ff == b.desired_ff && a.actual_ff == b.actual_ff && a.error == b.error &&
+           a.prev_error == b.prev_error && a.delta_error == b.delta_error && a.integral == b.integral &&
+           a.p == b.p && a.i == b.i && a.d == b.d && a.sum == b.sum && a.mid == b.mid && a.control == b.control;
+}
+
+static int run_selftest(const options &opt) {
+    const size_t n = opt.lanes;
+    batch b(n, opt.var);
+    std::vector<pid_golden::state> ref(n);
+    std::vector<uint16_t> gkp(n), gki(n), gkd(n);
+    std::vector<int32_t> des(n), act(n);
+    std::mt19937 rng(opt.seed);
+    const pid_golden::rules r = b.rule();
+
+    // lane 별 입력 성격: 0 무작위 32비트, 1 작은 오차 (감쇠 구간), 2 큰 오차 + 게인 0 (적분 제한), 3 완만한 추종
+    auto gen_gain = [&](size_t k) -> uint16_t {
+        uint32_t x = rng();
+        if ((k & 3) == 2) return 0;
+        return (x & 7) == 0 ? (uint16_t)(x >> 16) : (uint16_t)((x >> 16) & 0x0FFF);
+    };
+    for (size_t k = 0; k < n; k++) {
+        gkp[k] = gen_gain(k); gki[k] = gen_gain(k) & 0x00FF; gkd[k] = gen_gain(k);
+        b.set_gains(k, gkp[k], gki[k], gkd[k]);
+        des[k] = act[k] = 0;
+    }
+
+    size_t mismatches = 0;
+    double t_batch = 0;
+    for (size_t t = 0; t < opt.ticks; t++) {
+        for (size_t k = 0; k < n; k++) {
+            uint32_t x = rng();
+            switch (k & 3) {
+            case 0: des[k] = (int32_t)rng(); act[k] = (int32_t)x; break;
+            case 1: des[k] = (int32_t)(x % 7) - 3; act[k] = des[k] + (int32_t)((x >> 8) % 9) - 4; break;
+            case 2: des[k] = pid_golden::wrap_add(des[k], (int32_t)(x % 2000001) - 1000000); break;
+            default: des[k] += (int32_t)(x % 41) - 20; act[k] += (des[k] > act[k]) - (des[k] < act[k]); break;
+            }
+            // 가끔 게인 변경 / 리셋
+            if ((x >> 20) == 0) {
+                gkp[k] = gen_gain(k);
+                b.set_gains(k, gkp[k], gki[k], gkd[k]);
+            }
+            if ((x >> 22) == 1) { b.reset(k); ref[k] = pid_golden::state(); }
+        }
+
+        auto t0 = std::chrono::steady_clock::now();
+        pid_golden::parallel_for(n, opt.threads, [&](size_t lo, size_t hi) { b.tick(des.data(), act.data(), lo, hi); });
+        t_batch += std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count();
+
+        for (size_t k = 0; k < n; k++) {
+            pid_golden::tick(ref[k], r, gkp[k], gki[k], gkd[k], des[k], act[k]);
+            pid_golden::state s = b.get(k);
+            if (!same_state(s, ref[k])) {
+                if (mismatches++ < 10)
+                    fprintf(stderr, "[ERR] tick %zu lane %zu: control %d/%d integral %d/%d sum %lld/%lld\n", t, k,
+                            s.control, ref[k].control, s.integral, ref[k].integral,
+                            (long long)s.sum, (long long)ref[k].sum);
+            }
+        }
+    }
+
+    double rate = (double)n * opt.ticks / t_batch;
+    fprintf(stderr, "[%s] %zu lanes x %zu ticks, %zu mismatches, batch %.1f M lane-ticks/s\n",
+            mismatches ? "FAIL" : "OK", n, opt.ticks, mismatches, rate / 1e6);
+    return mismatches ? 1 : 0;
+}
+
+// ---------------------------------------------------------------- RTL 시험 벡터
+
+static int run_vectors(const options &opt) {
+    FILE *fp = stdout;
+    if (!opt.out_path.empty() && !(fp = fopen(opt.out_path.c_str(), "w"))) {
+        fprintf(stderr, "[ERR] cannot open %s\n", opt.out_path.c_str());
+        return 1;
+    }
+
+    std::mt19937 rng(opt.seed);
+    const pid_golden::rules r = pid_golden::rules_for(opt.var);
+    size_t lines = 0;
+
+    for (size_t sc = 0; sc < opt.scenarios; sc++) {
+        pid_golden::state m;
+        plant_batch plant(1);
+        uint16_t kp, ki, kd;
+        int kind = (int)(sc % 4);       // 0 폐루프 스텝, 1 무작위 32비트, 2 감쇠 구간, 3 적분 제한
+
+        if (kind == 0) { kp = q78(0.5 + 4.0 * (rng() % 100) / 100.0); ki = (uint16_t)(rng() % 32); kd = q78((rng() % 20)); }
+        else if (kind == 3) { kp = ki = kd = 0; }
+        else { kp = (uint16_t)rng(); ki = (uint16_t)rng(); kd = (uint16_t)rng(); }
+
+        int32_t des = 0, act = 0;
+        int32_t target = (int32_t)(rng() % 40001) - 20000;
+        for (size_t t = 0; t < opt.ticks; t++) {
+            uint32_t x = rng();
+            switch (kind) {
+            case 0: des = t < 10 ? 0 : target; act = plant.encoder[0]; break;
+            case 1: des = (int32_t)rng(); act = (int32_t)x; break;
+            case 2: des = (int32_t)(x % 7) - 3; act = des + (int32_t)((x >> 8) % 9) - 4; break;
+            default: des = (t & 64) ? 1500000000 : -1500000000; act = (int32_t)(x % 1000); break;
+            }
+            if (kind == 1 && (x >> 24) == 0) kp = (uint16_t)rng();
+
+            pid_golden::tick(m, r, kp, ki, kd, des, act);
+            if (kind == 0) plant.step(&m.control, 0, 1);
+
+            fprintf(fp, "%x %04x %04x %04x %08x %08x %04x %08x\n", t == 0 ? 1 : 0, kp, ki, kd,
+                    (uint32_t)des, (uint32_t)act, (uint16_t)m.control,
+                    (uint32_t)pid_golden::wrap_sub(m.desired_ff, m.actual_ff));
+            lines++;
+        }
+    }
+    if (fp != stdout) fclose(fp);
+    fprintf(stderr, "[OK] %zu scenarios, %zu ticks (%s)\n", opt.scenarios, lines,
+            opt.var == variant::fuzzy ? "Pid_pos_fuzzy.v" : "Pid_pos.v");
+    return 0;
+}
+
+// ---------------------------------------------------------------- 게인 스윕
+
+static int run_sweep(const options &opt) {
+    std::vector<double> kps = parse_range(opt.kp), kis = parse_range(opt.ki);
+    std::vector<double> kds = parse_range(opt.kd), js = parse_range(opt.inertia);
+    const size_t n = kps.size() * kis.size() * kds.size() * js.size();
+    const size_t ticks = (size_t)(opt.ms * TICK_HZ / 1000.0);
+    const float step = (float)opt.step;
+    const float band = std::max(1.0f, 0.02f * std::fabs(step));
+
+    batch b(n, opt.var);
+    plant_batch plant(n);
+    std::vector<double> lane_kp(n), lane_ki(n), lane_kd(n), lane_j(n);
+    size_t k = 0;
+    for (double j : js)
+        for (double kp : kps)
+            for (double ki : kis)
+                for (double kd : kds) {
+                    b.set_gains(k, q78(kp), q78(ki), q78(kd));
+                    plant.j[k] *= (float)j;
+                    lane_kp[k] = q78(kp) / 256.0; lane_ki[k] = q78(ki) / 256.0; lane_kd[k] = q78(kd) / 256.0;
+                    lane_j[k] = j;
+                    k++;
+                }
+
+    std::vector<int32_t> des(n, (int32_t)opt.step);
+    std::vector<float> iae(n, 0.0f), peak(n, 0.0f);
+    std::vector<uint32_t> last_out(n, 0), sat_ticks(n, 0);
+    std::vector<int16_t> max_ctl(n, 0);
+
+    auto t0 = std::chrono::steady_clock::now();
+    pid_golden::parallel_for(n, opt.threads, [&](size_t lo, size_t hi) {
+        for (size_t t = 0; t < ticks; t++) {
+            b.tick(des.data(), plant.encoder.data(), lo, hi);
+            plant.step(b.control.data(), lo, hi);
+            for (size_t q = lo; q < hi; q++) {
+                float y = (float)plant.encoder[q];
+                float e = step - y;
+                int16_t c = b.control[q];
+                iae[q] += std::fabs(e);
+                peak[q] = std::max(peak[q], step >= 0.0f ? y : -y);
+                last_out[q] = std::fabs(e) > band ? (uint32_t)t + 1 : last_out[q];
+                sat_ticks[q] += (c >= pid_golden::CTRL_LIMIT) | (c <= -pid_golden::CTRL_LIMIT);
+                max_ctl[q] = std::max<int16_t>(max_ctl[q], (int16_t)std::abs(c));
+            }
+        }
+    });
+    double sec = std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count();
+
+    FILE *fp = stdout;
+    if (!opt.out_path.empty() && !(fp = fopen(opt.out_path.c_str(), "w"))) {
+        fprintf(stderr, "[ERR] cannot open %s\n", opt.out_path.c_str());
+        return 1;
+    }
+    fprintf(fp, "kp,ki,kd,inertia_scale,iae,overshoot_pct,settle_ms,final_err,max_control,sat_ticks\n");
+    for (size_t q = 0; q < n; q++) {
+        double over = step != 0.0f ? 100.0 * (peak[q] - std::fabs(step)) / std::fabs(step) : 0.0;
+        double settle = last_out[q] >= ticks ? NAN : last_out[q] * 1000.0 / TICK_HZ;
+        fprintf(fp, "%.4f,%.4f,%.4f,%.3f,%.4g,%.2f,%.3f,%d,%d,%u\n", lane_kp[q], lane_ki[q], lane_kd[q], lane_j[q],
+                iae[q] / TICK_HZ, std::max(0.0, over), settle, (int)(opt.step - plant.encoder[q]),
+                max_ctl[q], sat_ticks[q]);
+    }
+    if (fp != stdout) fclose(fp);
+
+    fprintf(stderr, "[OK] %zu scenarios x %zu ticks in %.2f s (%.1f M lane-ticks/s)\n", n, ticks, sec,
+            (double)n * ticks / sec / 1e6);
+    return 0;
+}
+
+static void usage() {
+    fprintf(stderr, "usage: pid_golden selftest [--lanes N] [--ticks T] [--seed S] [--fuzzy] [--threads N]\n"
+                    "       pid_golden vectors [--scenarios N] [--ticks T] [--seed S] [--fuzzy] [-o vec.hex]\n"
+                    "       pid_golden sweep [--kp A:B:N] [--ki A:B:N] [--kd A:B:N] [--inertia A:B:N]\n"
+                    "                        [--step COUNTS] [--ms MS] [--fuzzy] [--threads N] [-o out.csv]\n");
+}
+
+int main(int argc, char **argv) {
+    if (argc < 2) { usage(); return 1; }
+    std::string mode = argv[1];
+    options opt;
+    if (mode == "vectors") opt.ticks = 400;
+    if (mode == "selftest") opt.ticks = 2000;
+
+    for (int i = 2; i < argc; i++) {
+        std::string a = argv[i];
+        auto next = [&]() -> const char * {
+            if (i + 1 >= argc) { usage(); exit(1); }
+            return argv[++i];
+        };
+        if (a == "--lanes") opt.lanes = (size_t)atol(next());
+        else if (a == "--ticks") opt.ticks = (size_t)atol(next());
+        else if (a == "--scenarios") opt.scenarios = (size_t)atol(next());
+        else if (a == "--seed") opt.seed = (unsigned)atol(next());
+        else if (a == "--threads") opt.threads = (unsigned)atoi(next());
+        else if (a == "--fuzzy") opt.var = variant::fuzzy;
+        else if (a == "--kp") opt.kp = next();
+        else if (a == "--ki") opt.ki = next();
+        else if (a == "--kd") opt.kd = next();
+        else if (a == "--inertia") opt.inertia = next();
+        else if (a == "--step") opt.step = atof(next());
+        else if (a == "--ms") opt.ms = atof(next());
+        else if (a == "-o") opt.out_path = next();
+        else { usage(); return 1; }
+    }
+
+    if (mode == "selftest") return run_selftest(opt);
+    if (mode == "vectors") return run_vectors(opt);
+    if (mode == "sweep") return run_sweep(opt);
+    usage();
+    return 1;
+}
@@ -0,0 +1,202 @@
+// pid_golden.hpp: pi_velocity_controller (Pid_pos.v / Pid_pos_fuzzy.v) 비트 단위 골든 모델 (호스트용)
+//
+// 20 kHz 제어 틱 하나 = RTL 의 clk_20k_enable 사이클 하나. 모든 레지스터가 같은 클럭에 갱신되므로
+// 우변은 항상 이전 틱 값이다 (오차 → P/I/D 곱 → 합 → >>> 8 → 포화가 틱마다 한 단계씩 진행).
+//   error      = desired_ff - actual_ff              (32비트 래핑)
+//   integral   : |control| >= sat_hold 이면 유지, error 가 (center ± band) 안이면 integral -= integral >>> 6,
+//                그 외 integral + error (32비트 래핑 후 ±2e9 제한)
+//                Pid_pos.v  : sat_hold 3950, center = 이번 틱 desired_pos 입력, band 2
+//                Pid_pos_fuzzy.v : sat_hold 3900, center 0, band 100
+//   p, i, d    = $signed(K) * (error, integral, delta_error)   (48비트)
+//   sum        = p + i + d (48비트 래핑), mid = sum >>> 8, control = ±4000 포화
+//
+// state / tick() 은 레지스터를 그대로 옮긴 스칼라 기준 구현이고, batch 는 같은 계산을 열 단위 (SoA) 배열과
+// 분기 없는 루프로 여러 시나리오에 동시에 적용한다 (자동 벡터화 대상). 두 구현은 selftest 로 비트 단위 비교한다.
+//
+//   pid_golden::batch b(4096);
+//   b.set_gains(lane, kp_q78, ki_q78, kd_q78);
+//   b.tick(desired, actual);                  // 모든 lane 한 틱, 결과는 b.control[lane]
+//   pid_golden::parallel_for(b.size(), 0, [&](size_t lo, size_t hi) { b.tick(desired, actual, lo, hi); });
+
+#ifndef PID_GOLDEN_HPP
+#define PID_GOLDEN_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+namespace pid_golden {
+
+constexpr int32_t INTEGRAL_LIMIT = 2000000000;
+constexpr int32_t CTRL_LIMIT = 4000;
+
+enum class variant { pos, fuzzy };
+
+struct rules {
+    int32_t sat_hold;           // |control| 이 이 값 이상이면 적분 유지
+    bool center_on_desired;     // 감쇠 구간 중심: true = desired_pos 입력, false = 0
+    int32_t band;               // 감쇠 구간 반폭 (경계 제외)
+};
+
+inline rules rules_for(variant v) {
+    return v == variant::fuzzy ? rules{3900, false, 100} : rules{3950, true, 2};
+}
+
+inline int32_t wrap_add(int32_t a, int32_t b) { return (int32_t)((uint32_t)a + (uint32_t)b); }
+inline int32_t wrap_sub(int32_t a, int32_t b) { return (int32_t)((uint32_t)a - (uint32_t)b); }
+inline int64_t sext48(int64_t v) { return (int64_t)((uint64_t)v << 16) >> 16; }
+
+// ---------------------------------------------------------------- 스칼라 기준 구현
+
+struct state {
+    int32_t desired_ff = 0, actual_ff = 0;
+    int32_t error = 0, prev_error = 0, delta_error = 0;
+    int32_t integral = 0;
+    int64_t p = 0, i = 0, d = 0;    // 48비트
+    int64_t sum = 0;                // pid_output (48비트)
+    int64_t mid = 0;                // pid_output_mid (41비트)
+    int16_t control = 0;
+};
+
+// kp/ki/kd: Kp_axi/Ki_axi/Kd_axi 입력 (16비트 그대로, 부호 있는 Q7.8 로 해석)
+inline void tick(state &m, const rules &r, uint16_t kp, uint16_t ki, uint16_t kd, int32_t desired, int32_t actual) {
+    const state o = m;
+
+    m.desired_ff = desired;
+    m.actual_ff = actual;
+    m.error = wrap_sub(o.desired_ff, o.actual_ff);
+    m.prev_error = o.error;
+    m.delta_error = wrap_sub(o.error, o.prev_error);
+
+    int32_t center = r.center_on_desired ? desired : 0;
+    if (o.control >= r.sat_hold || o.control <= -r.sat_hold) {
+        m.integral = o.integral;
+    } else if (o.error < wrap_add(center, r.band) && o.error > wrap_sub(center, r.band)) {
+        m.integral = o.integral - (o.integral >> 6);
+    } else {
+        int32_t acc = wrap_add(o.integral, o.error);
+        if (acc > INTEGRAL_LIMIT) m.integral = INTEGRAL_LIMIT;
+        else if (acc < -INTEGRAL_LIMIT) m.integral = -INTEGRAL_LIMIT;
+        else m.integral = acc;
+    }
+
+    m.p = (int64_t)(int16_t)kp * o.error;
+    m.i = (int64_t)(int16_t)ki * o.integral;
+    m.d = (int64_t)(int16_t)kd * o.delta_error;
+    m.sum = sext48(o.p + o.i + o.d);
+    m.mid = o.sum >> 8;
+
+    if (o.mid > CTRL_LIMIT) m.control = CTRL_LIMIT;
+    else if (o.mid < -CTRL_LIMIT) m.control = -CTRL_LIMIT;
+    else m.control = (int16_t)o.mid;
+}
+
+// ---------------------------------------------------------------- 일괄 (SoA) 구현
+
+class batch {
+public:
+    // 레지스터 (lane 별 열)
+    std::vector<int32_t> desired_ff, actual_ff, error, prev_error, delta_error, integral;
+    std::vector<int64_t> p, i, d, sum, mid;
+    std::vector<int16_t> control;
+    std::vector<int16_t> kp, ki, kd;
+
+    explicit batch(size_t n, variant v = variant::pos) : rules_(rules_for(v)), n_(n) {
+        for (auto *c : { &desired_ff, &actual_ff, &error, &prev_error, &delta_error, &integral }) c->assign(n, 0);
+        for (auto *c : { &p, &i, &d, &sum, &mid }) c->assign(n, 0);
+        for (auto *c : { &control, &kp, &ki, &kd }) c->assign(n, 0);
+    }
+
+    size_t size() const { return n_; }
+    const rules &rule() const { return rules_; }
+
+    void set_gains(size_t lane, uint16_t kp_q78, uint16_t ki_q78, uint16_t kd_q78) {
+        kp[lane] = (int16_t)kp_q78;
+        ki[lane] = (int16_t)ki_q78;
+        kd[lane] = (int16_t)kd_q78;
+    }
+
+    // reset_n 과 같음 (게인은 입력이므로 유지)
+    void reset(size_t lane) {
+        desired_ff[lane] = actual_ff[lane] = error[lane] = prev_error[lane] = delta_error[lane] = integral[lane] = 0;
+        p[lane] = i[lane] = d[lane] = sum[lane] = mid[lane] = 0;
+        control[lane] = 0;
+    }
+
+    state get(size_t lane) const {
+        state s;
+        s.desired_ff = desired_ff[lane]; s.actual_ff = actual_ff[lane];
+        s.error = error[lane]; s.prev_error = prev_error[lane]; s.delta_error = delta_error[lane];
+        s.integral = integral[lane];
+        s.p = p[lane]; s.i = i[lane]; s.d = d[lane]; s.sum = sum[lane]; s.mid = mid[lane];
+        s.control = control[lane];
+        return s;
+    }
+
+    void tick(const int32_t *desired, const int32_t *actual) { tick(desired, actual, 0, n_); }
+
+    // [lo, hi) lane 만 한 틱 (스레드 분할용). desired / actual 은 lane 인덱스 그대로
+    void tick(const int32_t *__restrict desired, const int32_t *__restrict actual, size_t lo, size_t hi) {
+        int32_t *__restrict des_ff = desired_ff.data(), *__restrict act_ff = actual_ff.data();
+        int32_t *__restrict err = error.data(), *__restrict perr = prev_error.data(), *__restrict derr = delta_error.data();
+        int32_t *__restrict integ = integral.data();
+        int64_t *__restrict pp = p.data(), *__restrict ii = i.data(), *__restrict dd = d.data();
+        int64_t *__restrict ss = sum.data(), *__restrict mm = mid.data();
+        int16_t *__restrict ctl = control.data();
+        const int16_t *__restrict gp = kp.data(), *__restrict gi = ki.data(), *__restrict gd = kd.data();
+        const int32_t hold = rules_.sat_hold, band = rules_.band;
+        const int32_t use_des = rules_.center_on_desired ? -1 : 0;
+
+        for (size_t j = lo; j < hi; j++) {
+            const int32_t o_des = des_ff[j], o_act = act_ff[j];
+            const int32_t o_err = err[j], o_perr = perr[j], o_derr = derr[j], o_int = integ[j];
+            const int64_t o_pid = pp[j] + ii[j] + dd[j];
+            const int64_t o_sum = ss[j], o_mid = mm[j];
+            const int32_t o_ctl = ctl[j];
+
+            des_ff[j] = desired[j];
+            act_ff[j] = actual[j];
+            err[j] = wrap_sub(o_des, o_act);
+            perr[j] = o_err;
+            derr[j] = wrap_sub(o_err, o_perr);
+
+            const int32_t center = desired[j] & use_des;
+            const bool sat = (o_ctl >= hold) | (o_ctl <= -hold);
+            const bool dec = (o_err < wrap_add(center, band)) & (o_err > wrap_sub(center, band));
+            const int32_t acc = wrap_add(o_int, o_err);
+            const int32_t acc_c = acc > INTEGRAL_LIMIT ? INTEGRAL_LIMIT : (acc < -INTEGRAL_LIMIT ? -INTEGRAL_LIMIT : acc);
+            const int32_t decayed = o_int - (o_int >> 6);
+            integ[j] = sat ? o_int : (dec ? decayed : acc_c);
+
+            pp[j] = (int64_t)gp[j] * o_err;
+            ii[j] = (int64_t)gi[j] * o_int;
+            dd[j] = (int64_t)gd[j] * o_derr;
+            ss[j] = sext48(o_pid);
+            mm[j] = o_sum >> 8;
+            ctl[j] = (int16_t)(o_mid > CTRL_LIMIT ? CTRL_LIMIT : (o_mid < -CTRL_LIMIT ? -CTRL_LIMIT : o_mid));
+        }
+    }
+
+private:
+    rules rules_;
+    size_t n_;
+};
+
+// [0, n) 을 threads 개 (0 = 코어 수) 구간으로 나눠 fn(lo, hi) 병렬 호출. 구간 경계는 64 lane 단위
+template <class F>
+void parallel_for(size_t n, unsigned threads, F fn) {
+    if (threads == 0) threads = std::max(1u, std::thread::hardware_concurrency());
+    size_t chunk = ((n + threads - 1) / threads + 63) & ~(size_t)63;
+    if (threads == 1 || chunk >= n) { fn((size_t)0, n); return; }
+
+    std::vector<std::thread> pool;
+    for (size_t lo = 0; lo < n; lo += chunk)
+        pool.emplace_back(fn, lo, std::min(n, lo + chunk));
+    for (std::thread &th : pool) th.join();
+}
+
+} // namespace pid_golden
+
+#endif